@@ -41,6 +41,7 @@
 #include <boost/bimap.hpp>
 #include <boost/graph/strong_components.hpp>
 #include <boost/graph/topological_sort.hpp>
+#include <boost/scope_exit.hpp>
 
 #include <boost/regex.hpp>
 #include <random>
@@ -892,7 +893,15 @@ void Document::onChanged(const Property* prop)
 void Document::onBeforeChangeProperty(const TransactionalObject* Who, const Property* What)
 {
     if (Who->isDerivedFrom<DocumentObject>()) {
-        signalBeforeChangeObject(*static_cast<const DocumentObject*>(Who), *What);
+        auto obj = static_cast<const DocumentObject*>(Who);
+        if (d->changeBatchDepth == 0) {
+            signalBeforeChangeObject(*obj, *What);
+        }
+        else if (d->batchedIndex.emplace(What->getID(), d->batchedChanges.size()).second) {
+            // only the first change of a property in a batch is announced
+            d->batchedChanges.push_back({obj->getID(), What, What->getID(), false});
+            signalBeforeChangeObject(*obj, *What);
+        }
     }
     if (!d->rollback && !globalIsRelabeling) {
         _checkTransaction(nullptr, What, __LINE__);
@@ -904,7 +913,54 @@ void Document::onBeforeChangeProperty(const TransactionalObject* Who, const Prop
 
 void Document::onChangedProperty(const DocumentObject* Who, const Property* What)
 {
-    signalChangedObject(*Who, *What);
+    if (d->changeBatchDepth == 0) {
+        signalChangedObject(*Who, *What);
+        return;
+    }
+    auto res = d->batchedIndex.emplace(What->getID(), d->batchedChanges.size());
+    if (res.second) {
+        d->batchedChanges.push_back({Who->getID(), What, What->getID(), true});
+    }
+    else {
+        d->batchedChanges[res.first->second].changed = true;
+    }
+}
+
+void Document::openChangeBatch()
+{
+    ++d->changeBatchDepth;
+}
+
+void Document::closeChangeBatch()
+{
+    if (d->changeBatchDepth == 0 || --d->changeBatchDepth > 0) {
+        return;
+    }
+    flushChangeBatch();
+}
+
+void Document::flushChangeBatch()
+{
+    auto changes = std::move(d->batchedChanges);
+    d->batchedChanges.clear();
+    d->batchedIndex.clear();
+    for (const auto& change : changes) {
+        if (!change.changed) {
+            continue;
+        }
+        // The object or a dynamic property may have been removed in the meantime
+        auto obj = getObjectByID(change.objectId);
+        if (!obj || !obj->getPropertyName(change.property)
+            || change.property->getID() != change.propertyId) {
+            continue;
+        }
+        signalChangedObject(*obj, *change.property);
+    }
+}
+
+bool Document::isChangeBatchOpen() const
+{
+    return d->changeBatchDepth > 0;
 }
 
 void Document::setTransactionMode(const int iMode) // NOLINT
@@ -2786,6 +2842,18 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
         return 0;
     }
 
+    // Listeners of signalChangedObject (e.g. shape binders tracking their
+    // support) must see the changes of an open batch before the objects are
+    // recomputed, and the changes made by the recompute are signalled at once.
+    int changeBatchDepth = d->changeBatchDepth;
+    if (changeBatchDepth > 0) {
+        flushChangeBatch();
+        d->changeBatchDepth = 0;
+    }
+    BOOST_SCOPE_EXIT_ALL(&) {
+        d->changeBatchDepth = changeBatchDepth;
+    };
+
     // delete recompute log
     d->clearRecomputeLog();
 
@@ -3269,23 +3337,55 @@ Document::addObjects(const char* sType, const std::vector<std::string>& objectNa
         return objects;
     }
 
-    for (auto it = objects.begin(); it != objects.end(); ++it) {
-        size_t index = std::distance(objects.begin(), it);
-        DocumentObject* pcObject = *it;
-        pcObject->setDocument(this);
+    // Reserve all names up front, objects created by setupObject() must not take them
+    std::vector<std::string> names;
+    names.reserve(objectNames.size());
+    for (const auto& name : objectNames) {
+        names.push_back(getUniqueObjectName(name.empty() ? type.getName() : name.c_str()));
+        d->objectNameManager.addExactName(names.back());
+    }
+    d->objectArray.reserve(d->objectArray.size() + objects.size());
+    d->objectMap.reserve(d->objectMap.size() + objects.size());
+    d->objectIdMap.reserve(d->objectIdMap.size() + objects.size());
+
+    std::size_t index = 0;
+    openChangeBatch();
+    try {
+        for (; index < objects.size(); ++index) {
+            DocumentObject* pcObject = objects[index];
+            pcObject->setDocument(this);
 
-        // Add the object but only activate the last one
-        bool isLast = index == (objects.size() - 1);
-        _addObject(pcObject,
-                   objectNames[index].c_str(),
-                   AddObjectOption::SetNewStatus
-                       | (isNew ? AddObjectOption::DoSetup : AddObjectOption::None)
-                       | (isLast ? AddObjectOption::ActivateObject : AddObjectOption::None));
+            // Add the object but only activate the last one
+            bool isLast = index == (objects.size() - 1);
+            _addObject(pcObject,
+                       names[index].c_str(),
+                       AddObjectOption::SetNewStatus | AddObjectOption::ReservedName
+                           | (isNew ? AddObjectOption::DoSetup : AddObjectOption::None)
+                           | (isLast ? AddObjectOption::ActivateObject : AddObjectOption::None));
+        }
     }
+    catch (...) {
+        // the failing object is in the document already, release the ones after it
+        for (++index; index < objects.size(); ++index) {
+            d->objectNameManager.removeExactName(names[index]);
+            delete objects[index];
+        }
+        closeChangeBatch();
+        throw;
+    }
+    closeChangeBatch();
 
+    signalNewObjects(objects);
     return objects;
 }
 
+std::vector<DocumentObject*>
+Document::addObjects(const char* sType, std::size_t count, const char* baseName, bool isNew)
+{
+    std::string name = Base::Tools::isNullOrEmpty(baseName) ? std::string() : baseName;
+    return addObjects(sType, std::vector<std::string>(count, name), isNew);
+}
+
 void Document::addObject(DocumentObject* obj, const char* name)
 {
     if (obj->getDocument()) {
@@ -3301,7 +3401,11 @@ void Document::_addObject(DocumentObject* pcObject, const char* pObjectName, Add
 {
     // get unique name
     string ObjectName;
-    if (!Base::Tools::isNullOrEmpty(pObjectName)) {
+    bool reserved = options.testFlag(AddObjectOption::ReservedName);
+    if (reserved) {
+        ObjectName = pObjectName;
+    }
+    else if (!Base::Tools::isNullOrEmpty(pObjectName)) {
         ObjectName = getUniqueObjectName(pObjectName);
     }
     else {
@@ -3310,7 +3414,9 @@ void Document::_addObject(DocumentObject* pcObject, const char* pObjectName, Add
 
     // insert in the name map
     d->objectMap[ObjectName] = pcObject;
-    d->objectNameManager.addExactName(ObjectName);
+    if (!reserved) {
+        d->objectNameManager.addExactName(ObjectName);
+    }
     // cache the pointer to the name string in the Object (for performance of
     // DocumentObject::getNameInDocument())
     pcObject->pcNameInDocument = &(d->objectMap.find(ObjectName)->first);
@@ -57,7 +57,8 @@ enum class AddObjectOption
     SetPartialStatus = 2,
     UnsetPartialStatus = 4,
     DoSetup = 8,
-    ActivateObject = 16
+    ActivateObject = 16,
+    ReservedName = 32
 };
 using AddObjectOptions = Base::Flags<AddObjectOption>;
 
@@ -203,6 +204,8 @@ public:
     fastsignals::signal<void(const Document&, const Property&)> signalChanged;
     /// Signal on new object.
     fastsignals::signal<void(const DocumentObject&)> signalNewObject;
+    /// Signal on objects added by addObjects(), after signalNewObject of each of them.
+    fastsignals::signal<void(const std::vector<DocumentObject*>&)> signalNewObjects;
     /// Signal on a deleted object.
     fastsignals::signal<void(const DocumentObject&)> signalDeletedObject;
     /// Signal before changing an object.
@@ -496,10 +499,30 @@ public:
      * @param[in] objectNames A list of object names
      * @param[in] isNew If false don't call the DocumentObject::setupObject()
      * callback (default is true)
+     *
+     * The names of all objects are reserved before the first one is set up.
+     * The change notifications of the new objects are batched as with
+     * openChangeBatch(), and signalNewObjects is emitted once at the end.
+     * An empty name generates a name based on @p sType.
      */
     std::vector<DocumentObject*>
     addObjects(const char* sType, const std::vector<std::string>& objectNames, bool isNew = true);
 
+    /**
+     * @brief Add a number of objects of a given type to the document.
+     *
+     * @param[in] sType    The type of created object
+     * @param[in] count    The number of objects to create
+     * @param[in] baseName The base of the generated names, if `nullptr` the
+     * names are based on @p sType.
+     * @param[in] isNew If false don't call the DocumentObject::setupObject()
+     * callback (default is true)
+     */
+    std::vector<DocumentObject*> addObjects(const char* sType,
+                                            std::size_t count,
+                                            const char* baseName = nullptr,
+                                            bool isNew = true);
+
     /**
      * @brief Remove an object from the document.
      *
@@ -903,6 +926,32 @@ public:
     /// Check whether a transaction is open.
     bool hasPendingTransaction() const;
 
+    /**
+     * @brief Open a batch of property changes.
+     *
+     * While a batch is open, the document still records the changes for
+     * Undo/Redo, but signalChangedObject is deferred until the batch is
+     * closed and then emitted once per changed property.  Batches can be
+     * nested, the signals are emitted when the outermost one is closed.
+     *
+     * recompute() emits the deferred signals before recomputing, so that
+     * listeners of signalChangedObject see the changes, and does not defer
+     * the changes made by the recompute itself.
+     */
+    void openChangeBatch();
+
+    /**
+     * @brief Close a batch of property changes.
+     *
+     * If this closes the outermost batch, signalChangedObject is emitted for
+     * every property changed in the batch whose object still exists, in the
+     * order of their first change.
+     */
+    void closeChangeBatch();
+
+    /// Check whether a batch of property changes is open.
+    bool isChangeBatchOpen() const;
+
     /**
      * @brief Get the undo or redo transaction ID.
      *
@@ -1300,7 +1349,8 @@ protected:
      *
      * @param[in] pcObject The object to add.
      * @param[in] pObjectName if `nullptr` generate a new unique name based on @p
-     * pcObject type, otherwise use this name.
+     * pcObject type, otherwise use this name.  With AddObjectOption::ReservedName
+     * the name is already unique and registered and is used as is.
      * @param[in] options A bitmask of AddObjectOptions.
      * @param[in] viewType Override object's view provider name.
      */
@@ -1321,6 +1371,9 @@ protected:
      */
     void _checkTransaction(DocumentObject* pcDelObj, const Property* What, int line);
 
+    /// Emit the signals deferred by the open change batch.
+    void flushChangeBatch();
+
     /**
      * @brief Break dependencies of an object.
      *
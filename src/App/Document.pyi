@@ -184,6 +184,26 @@ class Document(PropertyContainer):
         """
         ...
 
+    def openChangeBatch(self) -> None:
+        """
+        Open a batch of property changes.
+
+        The change notifications of the properties modified while the batch
+        is open are deferred and sent once per property when the batch is
+        closed. Batches can be nested. FreeCAD.ChangeBatch(doc) can be used
+        as a context manager instead of calling this function directly.
+
+        recompute() sends the deferred notifications before recomputing the
+        objects, and the changes made by the recompute are not deferred.
+        """
+        ...
+
+    def closeChangeBatch(self) -> None:
+        """
+        Close a batch of property changes, see openChangeBatch()
+        """
+        ...
+
     def addObject(
         self,
         type: str,
@@ -209,6 +229,22 @@ class Document(PropertyContainer):
         """
         ...
 
+    def addObjects(
+        self, type: str, names: Sequence[str] | int, /
+    ) -> list[DocumentObject]:
+        """
+        Add several objects of the same type to the document.
+
+        Args:
+            type: the type of the document objects to create.
+            names: the names of the new objects, or the number of objects to
+                   create with names based on the type.
+
+        The names are reserved before the objects are set up and the change
+        notifications of the new objects are sent in one batch.
+        """
+        ...
+
     def addProperty(
         self,
         type: str,
@@ -358,6 +394,9 @@ class Document(PropertyContainer):
     ) -> int:
         """
         Recompute the document and returns the amount of recomputed features.
+
+        The notifications deferred by an open change batch are sent first,
+        see openChangeBatch().
         """
         ...
 
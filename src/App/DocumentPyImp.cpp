@@ -409,6 +409,52 @@ PyObject* DocumentPy::addObject(PyObject* args, PyObject* kwd)
     return pcFtr->getPyObject();
 }
 
+PyObject* DocumentPy::addObjects(PyObject* args)
+{
+    char* sType;
+    PyObject* names;
+    if (!PyArg_ParseTuple(args, "sO", &sType, &names)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        std::vector<DocumentObject*> objects;
+        if (PyLong_Check(names)) {
+            long count = PyLong_AsLong(names);
+            if (count < 0) {
+                PyErr_SetString(PyExc_ValueError, "Number of objects must not be negative");
+                return nullptr;
+            }
+            objects = getDocumentPtr()->addObjects(sType, static_cast<std::size_t>(count));
+        }
+        else if (PySequence_Check(names) && !PyUnicode_Check(names)) {
+            std::vector<std::string> objectNames;
+            Py::Sequence seq(names);
+            objectNames.reserve(seq.size());
+            for (const auto& item : seq) {
+                if (!PyUnicode_Check(item.ptr())) {
+                    PyErr_SetString(PyExc_TypeError, "Expected a sequence of strings");
+                    return nullptr;
+                }
+                objectNames.push_back(Py::String(item).as_std_string("utf-8"));
+            }
+            objects = getDocumentPtr()->addObjects(sType, objectNames);
+        }
+        else {
+            PyErr_SetString(PyExc_TypeError, "Expected a sequence of names or a number");
+            return nullptr;
+        }
+
+        Py::List list;
+        for (auto obj : objects) {
+            list.append(Py::asObject(obj->getPyObject()));
+        }
+        return Py::new_reference_to(list);
+    }
+    PY_CATCH
+}
+
 PyObject* DocumentPy::removeObject(PyObject* args)
 {
     char* sName {};
@@ -613,6 +659,24 @@ PyObject* DocumentPy::commitTransaction(PyObject* args)
     Py_Return;
 }
 
+PyObject* DocumentPy::openChangeBatch(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+    getDocumentPtr()->openChangeBatch();
+    Py_Return;
+}
+
+PyObject* DocumentPy::closeChangeBatch(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+    getDocumentPtr()->closeChangeBatch();
+    Py_Return;
+}
+
 Py::Boolean DocumentPy::getHasPendingTransaction() const
 {
     return {getDocumentPtr()->hasPendingTransaction()};
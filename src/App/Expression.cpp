@@ -1106,10 +1106,29 @@ ExpressionPtr Expression::replaceObject(const DocumentObject *parent,
 }
 
 App::any Expression::getValueAsAny() const {
+    Quantity value;
+    NativeType type;
+    if(getNativeValue(value,type)) {
+        switch(type) {
+        case NativeType::Integer:
+            return App::any(static_cast<long>(value.getValue()));
+        case NativeType::Float:
+            return App::any(value.getValue());
+        default:
+            return App::any(value);
+        }
+    }
     Base::PyGILStateLocker lock;
     return pyObjectToAny(getPyValue());
 }
 
+bool Expression::getNativeValue(Quantity &value, NativeType &type) const {
+    // Components are applied on Python objects
+    if(!components.empty())
+        return false;
+    return _getNativeValue(value,type);
+}
+
 Py::Object Expression::getPyValue() const {
     try {
         Py::Object pyobj = _getPyValue();
@@ -1138,6 +1157,11 @@ void Expression::visit(ExpressionVisitor &v) {
 
 ExpressionPtr Expression::eval() const
 {
+    Quantity value;
+    NativeType type;
+    if (getNativeValue(value, type))
+        return std::make_unique<NumberExpression>(owner, value);
+
     Base::PyGILStateLocker lock;
     return expressionFromPy(owner, getPyValue());
 }
@@ -1247,6 +1271,28 @@ Py::Object UnitExpression::_getPyValue() const {
     return Py::Object(cache);
 }
 
+bool UnitExpression::_getNativeValue(Quantity &value, NativeType &type) const {
+    // Mirror pyFromQuantity()
+    value = quantity;
+    if (!quantity.isDimensionless()) {
+        type = NativeType::Quantity;
+        return true;
+    }
+    long l;
+    int i;
+    switch(essentiallyInteger(quantity.getValue(),l,i)) {
+    case 1:
+        type = NativeType::Integer;
+        return true;
+    case 2:
+        // Beyond the range that pyFromQuantity() converts faithfully
+        return false;
+    default:
+        type = NativeType::Float;
+        return true;
+    }
+}
+
 //
 // NumberExpression class
 //
@@ -1439,6 +1485,142 @@ Py::Object OperatorExpression::_getPyValue() const {
     return calc(this,op,left,right,false);
 }
 
+// Integers up to this magnitude are exactly representable as double, so the
+// native path can follow Python's arbitrary precision integer arithmetic.
+static constexpr double maxExactInteger = 9007199254740992.0; // 2^53
+
+static inline bool isExactInteger(double v) {
+    return std::fabs(v) < maxExactInteger;
+}
+
+static bool integerPower(double base, double exponent, double &res) {
+    auto e = static_cast<long long>(exponent);
+    res = 1.0;
+    while(e) {
+        if(e & 1) {
+            res *= base;
+            if(!isExactInteger(res))
+                return false;
+        }
+        e >>= 1;
+        if(e) {
+            base *= base;
+            if(!isExactInteger(base))
+                return false;
+        }
+    }
+    return true;
+}
+
+bool OperatorExpression::_getNativeValue(Quantity &value, NativeType &type) const {
+    switch(op) {
+    case ADD:
+    case SUB:
+    case MUL:
+    case UNIT:
+    case DIV:
+    case POW:
+    case NEG:
+    case POS:
+        break;
+    default:
+        // Comparisons yield Python bools, MOD also formats strings
+        return false;
+    }
+
+    Quantity l;
+    NativeType ltype;
+    if(!left->getNativeValue(l,ltype))
+        return false;
+
+    if(op == NEG || op == POS) {
+        value = op == NEG ? l * -1.0 : l;
+        type = ltype;
+        if(type == NativeType::Integer && value.getValue() == 0.0)
+            value.setValue(0.0);
+        return true;
+    }
+
+    Quantity r;
+    NativeType rtype;
+    if(!right->getNativeValue(r,rtype))
+        return false;
+
+    bool isQuantity = ltype == NativeType::Quantity || rtype == NativeType::Quantity;
+    bool isInteger = ltype == NativeType::Integer && rtype == NativeType::Integer;
+
+    // Whenever Python would raise, leave it to calc() to produce the exact
+    // same error.
+    try {
+        switch(op) {
+        case ADD:
+            value = l + r;
+            break;
+        case SUB:
+            value = l - r;
+            break;
+        case MUL:
+        case UNIT:
+            value = l * r;
+            break;
+        case DIV:
+            // Division by zero only raises without a Quantity involved
+            if(!isQuantity && r.getValue() == 0.0)
+                return false;
+            value = l / r;
+            isInteger = false;
+            break;
+        case POW: {
+            if(ltype == NativeType::Quantity) {
+                value = rtype == NativeType::Quantity ? l.pow(r) : l.pow(r.getValue());
+                break;
+            }
+            // Only a Quantity may be raised to a Quantity
+            if(rtype == NativeType::Quantity)
+                return false;
+            double base = l.getValue();
+            double exponent = r.getValue();
+            double res;
+            if(isInteger && exponent >= 0.0) {
+                if(!integerPower(base,exponent,res))
+                    return false;
+            }
+            else {
+                isInteger = false;
+                // ZeroDivisionError, complex result or OverflowError
+                if(base == 0.0 && exponent < 0.0)
+                    return false;
+                if(base < 0.0 && exponent != std::floor(exponent))
+                    return false;
+                res = std::pow(base,exponent);
+                if(std::isinf(res) && std::isfinite(base) && std::isfinite(exponent))
+                    return false;
+            }
+            value = Quantity(res);
+            break;
+        }
+        default:
+            return false;
+        }
+    }
+    catch(Base::Exception &) {
+        return false;
+    }
+
+    if(isQuantity)
+        type = NativeType::Quantity;
+    else if(!isInteger)
+        type = NativeType::Float;
+    else if(isExactInteger(value.getValue())) {
+        type = NativeType::Integer;
+        if(value.getValue() == 0.0)
+            value.setValue(0.0);
+    }
+    else
+        return false;
+    return true;
+}
+
 ExpressionPtr OperatorExpression::simplify() const
 {
     ExpressionPtr v1 = left->simplify();
@@ -2373,6 +2555,31 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
         v3 = pyToQuantity(e3,expr,"Invalid third argument.");
     }
 
+    switch (f) {
+    case ROTATIONX:
+    case ROTATIONY:
+    case ROTATIONZ:
+        if (!(v1.isDimensionlessOrUnit(Unit::Angle)))
+            _EXPR_THROW("Unit must be either empty or an angle.", expr);
+        return Py::asObject(new Base::RotationPy(Base::Rotation(
+            Vector3d(static_cast<double>(f == ROTATIONX), static_cast<double>(f == ROTATIONY), static_cast<double>(f == ROTATIONZ)),
+            Base::toRadians(v1.getValue()))));
+    case TRANSLATIONM:
+        if (v1.isDimensionlessOrUnit(Unit::Length) && v2.isDimensionlessOrUnit(Unit::Length) && v3.isDimensionlessOrUnit(Unit::Length))
+            return translationMatrix(v1.getValue(), v2.getValue(), v3.getValue());
+        _EXPR_THROW("Translation units must be a length or dimensionless.", expr);
+    default:
+        break;
+    }
+
+    return Py::asObject(new QuantityPy(new Quantity(evaluateScalar(expr, f, v1, v2, v3, args.size()))));
+}
+
+Quantity FunctionExpression::evaluateScalar(const Expression *expr, int f, const Quantity &v1,
+        const Quantity &v2, const Quantity &v3, std::size_t argCount)
+{
+    using std::numbers::pi;
+
     double output;
     Unit unit;
     double scaler = 1;
@@ -2384,9 +2591,6 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
     case COS:
     case SIN:
     case TAN:
-    case ROTATIONX:
-    case ROTATIONY:
-    case ROTATIONZ:
         if (!(v1.isDimensionlessOrUnit(Unit::Angle)))
             _EXPR_THROW("Unit must be either empty or an angle.", expr);
 
@@ -2426,7 +2630,7 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
         unit = v1.getUnit().cbrt();
         break;
     case ATAN2:
-        if (e2.isNone())
+        if (argCount < 2)
             _EXPR_THROW("Invalid second argument.",expr);
 
         if (v1.getUnit() != v2.getUnit())
@@ -2435,14 +2639,14 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
         scaler = 180.0 / pi;
         break;
     case MOD:
-        if (e2.isNone())
+        if (argCount < 2)
             _EXPR_THROW("Invalid second argument.",expr);
         if (v1.getUnit() != v2.getUnit() && !v1.isDimensionless() && !v2.isDimensionless())
             _EXPR_THROW("Units must be equal or dimensionless.",expr);
         unit = v1.getUnit();
         break;
     case POW: {
-        if (e2.isNone())
+        if (argCount < 2)
             _EXPR_THROW("Invalid second argument.",expr);
 
         if (!v2.isDimensionless())
@@ -2460,23 +2664,17 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
     }
     case HYPOT:
     case CATH:
-        if (e2.isNone())
+        if (argCount < 2)
             _EXPR_THROW("Invalid second argument.",expr);
         if (v1.getUnit() != v2.getUnit())
             _EXPR_THROW("Units must be equal.",expr);
 
-        if (args.size() > 2) {
-            if (e3.isNone())
-                _EXPR_THROW("Invalid second argument.",expr);
+        if (argCount > 2) {
             if (v2.getUnit() != v3.getUnit())
                 _EXPR_THROW("Units must be equal.",expr);
         }
         unit = v1.getUnit();
         break;
-    case TRANSLATIONM:
-        if (v1.isDimensionlessOrUnit(Unit::Length) && v2.isDimensionlessOrUnit(Unit::Length) && v3.isDimensionlessOrUnit(Unit::Length))
-            break;
-        _EXPR_THROW("Translation units must be a length or dimensionless.", expr);
     case NOT:
         unit = Unit();
         break;
@@ -2544,11 +2742,11 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
         break;
     }
     case HYPOT: {
-        output = sqrt(pow(v1.getValue(), 2) + pow(v2.getValue(), 2) + (!e3.isNone() ? pow(v3.getValue(), 2) : 0));
+        output = sqrt(pow(v1.getValue(), 2) + pow(v2.getValue(), 2) + (argCount > 2 ? pow(v3.getValue(), 2) : 0));
         break;
     }
     case CATH: {
-        output = sqrt(pow(v1.getValue(), 2) - pow(v2.getValue(), 2) - (!e3.isNone() ? pow(v3.getValue(), 2) : 0));
+        output = sqrt(pow(v1.getValue(), 2) - pow(v2.getValue(), 2) - (argCount > 2 ? pow(v3.getValue(), 2) : 0));
         break;
     }
     case ROUND:
@@ -2563,14 +2761,6 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
     case FLOOR:
         output = floor(value);
         break;
-    case ROTATIONX:
-    case ROTATIONY:
-    case ROTATIONZ:
-        return Py::asObject(new Base::RotationPy(Base::Rotation(
-            Vector3d(static_cast<double>(f == ROTATIONX), static_cast<double>(f == ROTATIONY), static_cast<double>(f == ROTATIONZ)),
-            value)));
-    case TRANSLATIONM:
-        return translationMatrix(v1.getValue(), v2.getValue(), v3.getValue());
     case NOT:
         output = asBool(value) ? 0 : 1;
         break;
@@ -2578,13 +2768,61 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
         _EXPR_THROW("Unknown function: " << f,0);
     }
 
-    return Py::asObject(new QuantityPy(new Quantity(scaler * output, unit)));
+    return Quantity(scaler * output, unit);
 }
 
 Py::Object FunctionExpression::_getPyValue() const {
     return evaluate(this,f,args);
 }
 
+bool FunctionExpression::_getNativeValue(Quantity &value, NativeType &type) const {
+    switch (f) {
+    case ACOS:
+    case ASIN:
+    case ATAN:
+    case ABS:
+    case EXP:
+    case LOG:
+    case LOG10:
+    case SIN:
+    case SINH:
+    case TAN:
+    case TANH:
+    case SQRT:
+    case CBRT:
+    case COS:
+    case COSH:
+    case ATAN2:
+    case MOD:
+    case POW:
+    case ROUND:
+    case TRUNC:
+    case CEIL:
+    case FLOOR:
+    case HYPOT:
+    case CATH:
+    case NOT:
+        break;
+    default:
+        return false;
+    }
+
+    if (!owner || args.empty())
+        return false;
+
+    // Like evaluate(), only look at the first three arguments
+    Quantity v[3];
+    NativeType t;
+    for (std::size_t i = 0; i < args.size() && i < 3; ++i) {
+        if (!args[i]->getNativeValue(v[i], t))
+            return false;
+    }
+
+    value = evaluateScalar(this, f, v[0], v[1], v[2], args.size());
+    type = NativeType::Quantity;
+    return true;
+}
+
 ExpressionPtr FunctionExpression::simplify() const
 {
     size_t numerics = 0;
@@ -2874,6 +3112,33 @@ Py::Object VariableExpression::_getPyValue() const {
     return var.getPyValue(true);
 }
 
+bool VariableExpression::_getNativeValue(Quantity &value, NativeType &type) const {
+    // Only plain numeric properties, anything else (sub paths, pseudo
+    // properties, links, etc.) is accessed through Python.
+    auto prop = var.getDirectProperty();
+    if (!prop)
+        return false;
+    if (auto qprop = freecad_cast<PropertyQuantity*>(prop)) {
+        value = qprop->getQuantityValue();
+        type = NativeType::Quantity;
+        return true;
+    }
+    if (auto fprop = freecad_cast<PropertyFloat*>(prop)) {
+        value = Quantity(fprop->getValue());
+        type = NativeType::Float;
+        return true;
+    }
+    if (auto iprop = freecad_cast<PropertyInteger*>(prop)) {
+        auto v = static_cast<double>(iprop->getValue());
+        if (!isExactInteger(v))
+            return false;
+        value = Quantity(v);
+        type = NativeType::Integer;
+        return true;
+    }
+    return false;
+}
+
 void VariableExpression::_toString(std::ostream &ss, bool persistent,int) const {
     if(persistent)
         ss << var.toPersistentString();
@@ -3233,6 +3498,13 @@ Py::Object ConstantExpression::_getPyValue() const {
     return Py::Object(cache);
 }
 
+bool ConstantExpression::_getNativeValue(Quantity &value, NativeType &type) const {
+    // None, True and False are Python objects of their own
+    if (!isNumber())
+        return false;
+    return NumberExpression::_getNativeValue(value, type);
+}
+
 bool ConstantExpression::isNumber() const {
     return strcmp(name,"None")
         && strcmp(name,"True")
@@ -531,6 +531,29 @@ public:
     /// Get the value as a Python object.
     Py::Object getPyValue() const;
 
+    /// The Python type a natively evaluated value stands for.
+    enum class NativeType {
+        Integer,
+        Float,
+        Quantity,
+    };
+
+    /**
+     * @brief Get the value without going through Python.
+     *
+     * Plain numeric expressions (literals, references to numeric properties,
+     * arithmetic and the scalar math functions) are evaluated directly on
+     * Base::Quantity, so they neither need the GIL nor create intermediate
+     * Python objects.  The result is identical to the one of getPyValue().
+     *
+     * @param[out] value The value of the expression.
+     * @param[out] type The Python type getPyValue() would have returned.
+     *
+     * @return true if the expression was evaluated, false if it has to be
+     * evaluated through Python instead.
+     */
+    bool getNativeValue(Base::Quantity& value, NativeType& type) const;
+
     /**
      * @brief Check if this expression is the same as another.
      *
@@ -563,6 +586,7 @@ protected:
     virtual void _moveCells(const CellAddress &, int, int, ExpressionVisitor &) {}
     virtual void _offsetCells(int, int, ExpressionVisitor &) {}
     virtual Py::Object _getPyValue() const = 0;
+    virtual bool _getNativeValue(Base::Quantity &, NativeType &) const {return false;}
     virtual void _visit(ExpressionVisitor &) {}
 
 protected:
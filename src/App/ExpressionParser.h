@@ -122,6 +122,7 @@ protected:
     Expression* _copy() const override;
     void _toString(std::ostream& ss, bool persistent, int indent) const override;
     Py::Object _getPyValue() const override;
+    bool _getNativeValue(Base::Quantity& value, NativeType& type) const override;
 
 protected:
     mutable PyObject* cache = nullptr;
@@ -175,6 +176,7 @@ public:
 
 protected:
     Py::Object _getPyValue() const override;
+    bool _getNativeValue(Base::Quantity& value, NativeType& type) const override;
     void _toString(std::ostream& ss, bool persistent, int indent) const override;
     Expression* _copy() const override;
 
@@ -244,6 +246,8 @@ protected:
 
     Py::Object _getPyValue() const override;
 
+    bool _getNativeValue(Base::Quantity& value, NativeType& type) const override;
+
     void _toString(std::ostream& ss, bool persistent, int indent) const override;
 
     void _visit(ExpressionVisitor& v) override;
@@ -434,7 +438,14 @@ protected:
                                              const std::vector<Expression*>& arguments,
                                              const Base::Matrix4D* transformationMatrix);
     static Py::Object translationMatrix(double x, double y, double z);
+    static Base::Quantity evaluateScalar(const Expression* expression,
+                                         int type,
+                                         const Base::Quantity& v1,
+                                         const Base::Quantity& v2,
+                                         const Base::Quantity& v3,
+                                         std::size_t argCount);
     Py::Object _getPyValue() const override;
+    bool _getNativeValue(Base::Quantity& value, NativeType& type) const override;
     Expression* _copy() const override;
     void _visit(ExpressionVisitor& v) override;
     void _toString(std::ostream& ss, bool persistent, int indent) const override;
@@ -498,6 +509,7 @@ public:
 protected:
     Expression* _copy() const override;
     Py::Object _getPyValue() const override;
+    bool _getNativeValue(Base::Quantity& value, NativeType& type) const override;
     void _toString(std::ostream& ss, bool persistent, int indent) const override;
     bool _isIndexable() const override;
     void _getIdentifiers(std::map<App::ObjectIdentifier, bool>&) const override;
@@ -691,6 +691,28 @@ class ReturnType(IntEnum):
 
 App.ReturnType = ReturnType
 
+class ChangeBatch:
+    """
+    Context manager deferring the change notifications of a document.
+
+    with FreeCAD.ChangeBatch(doc):
+        for obj in objects:
+            obj.Length = 10
+    """
+
+    def __init__(self, doc=None):
+        self.doc = doc if doc else App.ActiveDocument
+
+    def __enter__(self):
+        self.doc.openChangeBatch()
+        return self.doc
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        self.doc.closeChangeBatch()
+        return False
+
+App.ChangeBatch = ChangeBatch
+
 
 # ┌────────────────────────────────────────────────┐
 # │ Init Framework                                 │
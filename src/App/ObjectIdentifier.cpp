@@ -22,6 +22,7 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <atomic>
 #include <cassert>
 #include <limits>
 
@@ -843,6 +844,116 @@ App::DocumentObject* ObjectIdentifier::getDocumentObject(const App::Document* do
     }
 }
 
+// Document and object lookups by name or label are remembered per object
+// identifier and stay valid as long as this revision does not change.
+static std::atomic<std::size_t> _resolveRevision {1};
+static std::atomic<std::size_t> _resolveCacheHits {0};
+static std::atomic<std::size_t> _resolveCacheMisses {0};
+
+static std::size_t resolveRevision()
+{
+    static const bool inited = [] {
+        auto invalidate = [] {
+            ObjectIdentifier::invalidateResolveCache();
+        };
+        auto& app = GetApplication();
+        app.signalNewDocument.connect([invalidate](const Document&, bool) {
+            invalidate();
+        });
+        app.signalDeleteDocument.connect([invalidate](const Document&) {
+            invalidate();
+        });
+        app.signalRelabelDocument.connect([invalidate](const Document&) {
+            invalidate();
+        });
+        app.signalStartRestoreDocument.connect([invalidate](const Document&) {
+            invalidate();
+        });
+        app.signalFinishRestoreDocument.connect([invalidate](const Document&) {
+            invalidate();
+        });
+        app.signalNewObject.connect([invalidate](const DocumentObject&) {
+            invalidate();
+        });
+        app.signalDeletedObject.connect([invalidate](const DocumentObject&) {
+            invalidate();
+        });
+        app.signalRelabelObject.connect([invalidate](const DocumentObject&) {
+            invalidate();
+        });
+        return true;
+    }();
+    (void)inited;
+    return _resolveRevision.load(std::memory_order_relaxed);
+}
+
+static bool isSameName(const ObjectIdentifier::String& a, const ObjectIdentifier::String& b)
+{
+    return a == b && a.isRealString() == b.isRealString()
+        && a.isForceIdentifier() == b.isForceIdentifier();
+}
+
+void ObjectIdentifier::invalidateResolveCache()
+{
+    ++_resolveRevision;
+}
+
+ObjectIdentifier::ResolveCacheStats ObjectIdentifier::getResolveCacheStats()
+{
+    ResolveCacheStats stats;
+    stats.hits = _resolveCacheHits.load(std::memory_order_relaxed);
+    stats.misses = _resolveCacheMisses.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void ObjectIdentifier::resetResolveCacheStats()
+{
+    _resolveCacheHits = 0;
+    _resolveCacheMisses = 0;
+}
+
+Document* ObjectIdentifier::lookupDocument(const String& name, bool* ambiguous) const
+{
+    std::size_t revision = resolveRevision();
+    auto& cache = _resolveCache;
+    if (cache.documentRevision == revision && isSameName(cache.documentName, name)) {
+        _resolveCacheHits.fetch_add(1, std::memory_order_relaxed);
+    }
+    else {
+        _resolveCacheMisses.fetch_add(1, std::memory_order_relaxed);
+        cache.documentAmbiguous = false;
+        cache.document = getDocument(name, &cache.documentAmbiguous);
+        cache.documentName = name;
+        cache.documentRevision = revision;
+    }
+    if (ambiguous && cache.documentAmbiguous) {
+        *ambiguous = true;
+    }
+    return cache.document;
+}
+
+DocumentObject* ObjectIdentifier::lookupDocumentObject(const Document* doc,
+                                                       const String& name,
+                                                       std::bitset<32>& flags) const
+{
+    std::size_t revision = resolveRevision();
+    auto& cache = _resolveCache;
+    if (cache.objectRevision == revision && cache.objectDocument == doc
+        && isSameName(cache.objectName, name)) {
+        _resolveCacheHits.fetch_add(1, std::memory_order_relaxed);
+    }
+    else {
+        _resolveCacheMisses.fetch_add(1, std::memory_order_relaxed);
+        cache.objectFlags.reset();
+        cache.object = getDocumentObject(doc, name, cache.objectFlags);
+        cache.objectDocument = doc;
+        cache.objectName = name;
+        cache.objectRevision = revision;
+    }
+    flags |= cache.objectFlags;
+    return cache.object;
+}
+
 void ObjectIdentifier::resolve(ResolveResults& results) const
 {
     if (!owner) {
@@ -853,7 +964,7 @@ void ObjectIdentifier::resolve(ResolveResults& results) const
 
     /* Document name specified? */
     if (!documentName.getString().empty()) {
-        results.resolvedDocument = getDocument(documentName, &docAmbiguous);
+        results.resolvedDocument = lookupDocument(documentName, &docAmbiguous);
         results.resolvedDocumentName = documentName;
     }
     else {
@@ -886,7 +997,7 @@ void ObjectIdentifier::resolve(ResolveResults& results) const
     if (!documentObjectName.getString().empty()) {
         results.resolvedDocumentObjectName = documentObjectName;
         results.resolvedDocumentObject =
-            getDocumentObject(results.resolvedDocument, documentObjectName, results.flags);
+            lookupDocumentObject(results.resolvedDocument, documentObjectName, results.flags);
         if (!results.resolvedDocumentObject) {
             return;
         }
@@ -919,7 +1030,7 @@ void ObjectIdentifier::resolve(ResolveResults& results) const
             }
 
             results.resolvedDocumentObject =
-                getDocumentObject(results.resolvedDocument, components[0].name, results.flags);
+                lookupDocumentObject(results.resolvedDocument, components[0].name, results.flags);
 
             /* Possible to resolve component to a document object? */
             if (results.resolvedDocumentObject) {
@@ -1218,6 +1329,16 @@ Property* ObjectIdentifier::getProperty(int* ptype) const
     return result.resolvedProperty;
 }
 
+Property* ObjectIdentifier::getDirectProperty() const
+{
+    ResolveResults result(*this);
+    if (result.propertyType != PseudoNone
+        || result.propertyIndex + 1 != static_cast<int>(components.size())) {
+        return nullptr;
+    }
+    return result.resolvedProperty;
+}
+
 Property* ObjectIdentifier::resolveProperty(const App::DocumentObject* obj,
                                             const char* propertyName,
                                             App::DocumentObject*& sobj,
@@ -808,6 +808,7 @@ public:
         localProperty = other.localProperty;
         _cache = std::move(other._cache);
         _hash = other._hash;
+        _resolveCache = std::move(other._resolveCache);
         return *this;
     }
 
@@ -988,6 +989,14 @@ public:
      */
     App::Property* getProperty(int* ptype = nullptr) const;
 
+    /**
+     * @brief Get the property this object identifier refers to as a whole.
+     *
+     * @return A pointer to the property if the identifier resolves to a real
+     * (i.e. not pseudo) property without any sub path, or `nullptr` otherwise.
+     */
+    App::Property* getDirectProperty() const;
+
     /**
      * @brief Create a canonical representation of the object identifier.
      *
@@ -1433,6 +1442,30 @@ public:
      */
     std::size_t hash() const;
 
+    /// Statistics of the document and document object lookup cache.
+    struct ResolveCacheStats
+    {
+        std::size_t hits {0};
+        std::size_t misses {0};
+    };
+
+    /**
+     * @brief Invalidate the cached lookups of all object identifiers.
+     *
+     * Documents and document objects referenced by name or label are looked
+     * up once and remembered by each object identifier. The cache is
+     * invalidated automatically whenever a document or document object is
+     * created, deleted, relabeled or restored. Call this method if names may
+     * resolve differently for any other reason.
+     */
+    static void invalidateResolveCache();
+
+    /// Get the number of cached and uncached lookups since the last reset.
+    static ResolveCacheStats getResolveCacheStats();
+
+    /// Reset the statistics returned by getResolveCacheStats().
+    static void resetResolveCacheStats();
+
 protected:
     /**
      * @brief A structure to hold the results of resolving an ObjectIdentifier.
@@ -1537,6 +1570,29 @@ protected:
      */
     void resolve(ResolveResults& results) const;
 
+    /**
+     * @brief Look up a document by name or label, using the resolve cache.
+     *
+     * @param[in] name The name or label of the document.
+     * @param[out] ambiguous Set to true if the name is ambiguous.
+     *
+     * @return The document or `nullptr` if not found.
+     */
+    App::Document* lookupDocument(const String& name, bool* ambiguous) const;
+
+    /**
+     * @brief Look up a document object by name or label, using the resolve cache.
+     *
+     * @param[in] doc The document to search in.
+     * @param[in] name The name or label of the document object.
+     * @param[in,out] flags The resolve flags to update.
+     *
+     * @return The document object or `nullptr` if not found.
+     */
+    App::DocumentObject* lookupDocumentObject(const App::Document* doc,
+                                              const String& name,
+                                              std::bitset<32>& flags) const;
+
     /**
      * @brief Resolve ambiguity in the object identifier.
      *
@@ -1582,8 +1638,24 @@ private:
     getDocumentObject(const App::Document* doc, const String& name, std::bitset<32>& flags);
 
 private:
+    /// Remembered lookups of resolve(), valid for one cache revision.
+    struct ResolveCache
+    {
+        std::size_t documentRevision {0};
+        String documentName;
+        App::Document* document {nullptr};
+        bool documentAmbiguous {false};
+
+        std::size_t objectRevision {0};
+        const App::Document* objectDocument {nullptr};
+        String objectName;
+        App::DocumentObject* object {nullptr};
+        std::bitset<32> objectFlags;
+    };
+
     std::string _cache;  // Cached string represstation of this identifier
     std::size_t _hash;   // Cached hash of this string
+    mutable ResolveCache _resolveCache;
 };
 
 /**
@@ -30,6 +30,9 @@
 #include <boost/any.hpp>
 #include <fastsignals/signal.h>
 #include <bitset>
+#include <map>
+#include <memory>
+#include <span>
 #include <string>
 #include <FCGlobal.h>
 
@@ -486,6 +489,47 @@ public:
      */
     virtual void Paste(const Property& from) = 0;
 
+    /**
+     * @brief Returns a copy of the property before it is changed.
+     *
+     * Transactions call this instead of Copy() before the first change of the
+     * property, and pass the copy to Paste() on undo/redo. A property that
+     * knows which part of its value is about to change may return a partial
+     * copy holding only that part.
+     *
+     * @return A new copy of the property, by default Copy().
+     */
+    virtual Property* copyBeforeChange() const
+    {
+        return Copy();
+    }
+
+    /**
+     * @brief Completes a copy made by copyBeforeChange() before a further change.
+     *
+     * Transactions call this before the following changes of the property, so
+     * that a partial copy also covers the parts changed by them.
+     *
+     * @param[in,out] copy The copy made by copyBeforeChange().
+     */
+    virtual void mergeBeforeChange(Property* copy) const
+    {
+        (void)copy;
+    }
+
+    /**
+     * @brief Whether this is a partial copy made by copyBeforeChange().
+     *
+     * A partial copy can only be pasted into the property it was copied from,
+     * as it holds the changed parts of the value only.
+     *
+     * @return True if the copy does not hold the whole value.
+     */
+    virtual bool isPartialCopy() const
+    {
+        return false;
+    }
+
     /**
      * @brief Callback for when a child property has changed value.
      *
@@ -1085,18 +1129,73 @@ public:
             throw Base::RuntimeError("index out of bound");
         }
 
-        atomic_change guard(*this);
+        atomic_change guard(*this, false);
         if (index == -1 || index == size) {
+            aboutToChange(guard, {});
             index = size;
             setSize(index + 1, value);
         }
         else {
+            aboutToChange(guard, {&index, 1});
             _lValueList[index] = value;
         }
         this->_touchList.insert(index);
         guard.tryInvoke();
     }
 
+    /**
+     * @brief Return a copy of the list before it is changed.
+     *
+     * If only some elements are about to be changed, e.g. by set1Value(), and
+     * Paste() accepts partial copies, see canPasteChanges(), the copy holds
+     * the size of the list and the old values of these elements only.
+     *
+     * @return A new, possibly partial, copy of the property.
+     */
+    Property* copyBeforeChange() const override
+    {
+        if (!_changing || !canPasteChanges()) {
+            return this->Copy();
+        }
+        auto copy = static_cast<PropertyListsT*>(
+            static_cast<Property*>(this->getTypeId().createInstance()));
+        copy->_delta = std::make_unique<Delta>();
+        copy->_delta->size = getSize();
+        recordChanges(*copy->_delta);
+        return copy;
+    }
+
+    /**
+     * @brief Complete a copy made by copyBeforeChange() before a further change.
+     *
+     * A partial copy gets the old values of the elements about to be changed,
+     * or becomes a full copy if they are not known.
+     *
+     * @param[in,out] copy The copy made by copyBeforeChange().
+     */
+    void mergeBeforeChange(Property* copy) const override
+    {
+        auto list = static_cast<PropertyListsT*>(copy);
+        if (!list->_delta) {
+            return;
+        }
+        if (_changing) {
+            recordChanges(*list->_delta);
+            return;
+        }
+        list->_lValueList = _lValueList;
+        list->_lValueList.resize(list->_delta->size);
+        for (const auto& [index, value] : list->_delta->values) {
+            list->_lValueList[index] = value;
+        }
+        list->_delta.reset();
+    }
+
+    bool isPartialCopy() const override
+    {
+        return _delta != nullptr;
+    }
+
     template<std::predicate<const T&> F>
     int removeIf(F f) {
         ListT vals = _lValueList;
@@ -1120,7 +1219,8 @@ protected:
             return;
         }
         assert(vals.size() == indices.size());
-        atomic_change guard(*this);
+        atomic_change guard(*this, false);
+        aboutToChange(guard, indices);
         int i {0};
         for (auto index : indices) {
             set1Value(index, getPyValue(vals[i]));
@@ -1138,8 +1238,96 @@ protected:
      */
     virtual T getPyValue(PyObject* item) const = 0;
 
+    /**
+     * @brief Whether Paste() accepts the partial copies made by copyBeforeChange().
+     *
+     * A subclass returning true must apply them in Paste() with pasteChanges().
+     */
+    virtual bool canPasteChanges() const
+    {
+        return false;
+    }
+
+    /**
+     * @brief Paste a partial copy made by copyBeforeChange().
+     *
+     * @param[in] from The property to paste from.
+     * @return False if @p from is a full copy, which is left to the caller.
+     */
+    bool pasteChanges(const PropertyListsT& from)
+    {
+        if (!from._delta) {
+            return false;
+        }
+        const Delta& delta = *from._delta;
+        int size = getSize();
+        std::vector<int> indices;
+        indices.reserve(delta.values.size());
+        for (const auto& entry : delta.values) {
+            indices.push_back(entry.first);
+        }
+        // the elements removed again are recorded for the redo
+        for (int index = delta.size; index < size; ++index) {
+            indices.push_back(index);
+        }
+
+        atomic_change guard(*this, false);
+        aboutToChange(guard, indices);
+        setSize(delta.size);
+        for (const auto& [index, value] : delta.values) {
+            _lValueList[index] = value;
+        }
+        if (delta.size != size) {
+            this->_touchList.clear();
+        }
+        else {
+            this->_touchList.insert(indices.begin(), indices.end());
+        }
+        guard.tryInvoke();
+        return true;
+    }
+
+private:
+    /// Size and old values of the changed elements held by a partial copy
+    struct Delta
+    {
+        int size {0};
+        std::map<int, T> values;
+    };
+
+    /// Mark the property as changed before changing the elements at @p indices only
+    void aboutToChange(atomic_change& guard, std::span<const int> indices)
+    {
+        _changing = &indices;
+        try {
+            guard.aboutToChange();
+        }
+        catch (...) {
+            _changing = nullptr;
+            throw;
+        }
+        _changing = nullptr;
+    }
+
+    /// Record the old values of the elements about to be changed in @p delta
+    void recordChanges(Delta& delta) const
+    {
+        for (int index : *_changing) {
+            // the elements added since the copy was made are simply removed again
+            if (index >= 0 && index < delta.size && index < getSize()) {
+                delta.values.emplace(index, _lValueList[index]);
+            }
+        }
+    }
+
 protected:
     ListT _lValueList;
+
+private:
+    // set on a partial copy made by copyBeforeChange()
+    std::unique_ptr<Delta> _delta;
+    // the elements about to be changed, while calling aboutToSetValue()
+    const std::span<const int>* _changing {nullptr};
 };
 
 }  // namespace App
@@ -377,7 +377,10 @@ Property* PropertyVectorList::Copy() const
 
 void PropertyVectorList::Paste(const Property& from)
 {
-    setValues(dynamic_cast<const PropertyVectorList&>(from)._lValueList);
+    const auto& list = dynamic_cast<const PropertyVectorList&>(from);
+    if (!pasteChanges(list)) {
+        setValues(list._lValueList);
+    }
 }
 
 unsigned int PropertyVectorList::getMemSize() const
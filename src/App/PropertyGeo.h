@@ -248,6 +248,11 @@ public:
 
 protected:
     Base::Vector3d getPyValue(PyObject*) const override;
+
+    bool canPasteChanges() const override
+    {
+        return true;
+    }
 };
 
 /// Property representing a 4x4 matrix
@@ -914,7 +914,10 @@ Property* PropertyIntegerList::Copy() const
 
 void PropertyIntegerList::Paste(const Property& from)
 {
-    setValues(dynamic_cast<const PropertyIntegerList&>(from)._lValueList);
+    const auto& list = dynamic_cast<const PropertyIntegerList&>(from);
+    if (!pasteChanges(list)) {
+        setValues(list._lValueList);
+    }
 }
 
 unsigned int PropertyIntegerList::getMemSize() const
@@ -1506,7 +1509,10 @@ Property* PropertyFloatList::Copy() const
 
 void PropertyFloatList::Paste(const Property& from)
 {
-    setValues(dynamic_cast<const PropertyFloatList&>(from)._lValueList);
+    const auto& list = dynamic_cast<const PropertyFloatList&>(from);
+    if (!pasteChanges(list)) {
+        setValues(list._lValueList);
+    }
 }
 
 unsigned int PropertyFloatList::getMemSize() const
@@ -2655,7 +2661,10 @@ Property* PropertyColorList::Copy() const
 
 void PropertyColorList::Paste(const Property& from)
 {
-    setValues(dynamic_cast<const PropertyColorList&>(from)._lValueList);
+    const auto& list = dynamic_cast<const PropertyColorList&>(from);
+    if (!pasteChanges(list)) {
+        setValues(list._lValueList);
+    }
 }
 
 unsigned int PropertyColorList::getMemSize() const
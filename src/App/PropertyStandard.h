@@ -399,6 +399,11 @@ public:
 
 protected:
     long getPyValue(PyObject* item) const override;
+
+    bool canPasteChanges() const override
+    {
+        return true;
+    }
 };
 
 /** Integer list properties
@@ -741,6 +746,11 @@ public:
 
 protected:
     double getPyValue(PyObject* item) const override;
+
+    bool canPasteChanges() const override
+    {
+        return true;
+    }
 };
 
 
@@ -1102,6 +1112,11 @@ public:
 protected:
     Base::Color getPyValue(PyObject* py) const override;
 
+    bool canPasteChanges() const override
+    {
+        return true;
+    }
+
 private:
     bool requiresAlphaConversion {false}; // In 1.1 the handling of alpha was inverted
 };
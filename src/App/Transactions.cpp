@@ -261,7 +261,11 @@ void Transaction::addObjectChange(const TransactionalObject* Obj, const Property
 
     if (pos != index.end()) {
         auto To = pos->second;
-        To->setProperty(Prop);
+        // An object added in this transaction is removed as a whole on undo, and its
+        // property changes are never applied, so there is no need to copy them.
+        if (To->status != TransactionObject::Del) {
+            To->setProperty(Prop);
+        }
     }
     else if (auto To = TransactionFactory::instance().createTransaction(Obj->getTypeId())) {
         To->status = TransactionObject::Chn;
@@ -302,7 +306,7 @@ void TransactionObject::applyDel(Document& /*Doc*/, TransactionalObject* /*pcObj
 void TransactionObject::applyNew(Document& /*Doc*/, TransactionalObject* /*pcObj*/)
 {}
 
-void TransactionObject::applyChn(Document& /*Doc*/, TransactionalObject* pcObj, bool /* Forward */)
+void TransactionObject::applyChn(Document& /*Doc*/, TransactionalObject* pcObj, bool Forward)
 {
     if (status == New || status == Chn) {
         // Property change order is not preserved, as it is recursive in nature
@@ -336,13 +340,19 @@ void TransactionObject::applyChn(Document& /*Doc*/, TransactionalObject* pcObj,
                     // not a dynamic property, nothing to do
                     continue;
                 }
-
                 // It is possible for the dynamic property to be removed and
                 // restored. But since restoring property is actually creating
                 // a new property, the property key inside redo stack will not
                 // match. So we search by name first.
                 prop = pcObj->getDynamicPropertyByName(data.name.c_str());
                 if (!prop) {
+                    if (data.property->isPartialCopy()) {
+                        // the property was removed without a transaction, and
+                        // the changed parts alone cannot restore its value
+                        FC_WARN("Cannot " << (Forward ? "redo" : "undo")
+                                          << " change of removed property " << data.name);
+                        continue;
+                    }
                     // Still not found, re-create the property
                     prop = pcObj->addDynamicProperty(data.propertyType.getName(),
                                                      data.name.c_str(),
@@ -394,10 +404,14 @@ void TransactionObject::setProperty(const Property* pcProp)
         static_cast<DynamicProperty::PropData&>(data) =
             pcProp->getContainer()->getDynamicPropertyData(pcProp);
         data.propertyOrig = pcProp;
-        data.property = pcProp->Copy();
+        data.property = pcProp->copyBeforeChange();
         data.propertyType = pcProp->getTypeId();
         data.property->setStatusValue(pcProp->getStatus());
     }
+    else if (data.property && data.nameOrig.empty()) {
+        // a partial copy must also cover this change
+        pcProp->mergeBeforeChange(data.property);
+    }
 }
 
 void TransactionObject::renameProperty(const Property* pcProp, const char* oldName)
@@ -429,6 +443,11 @@ void TransactionObject::addOrRemoveProperty(const Property* pcProp, bool add)
             // transaction, so they cancel each other out.
             _PropChangeMap.erase(pcProp->getID());
         }
+        else if (!add) {
+            // the property is re-created on undo, so a partial copy of an
+            // earlier change must hold the whole value
+            pcProp->mergeBeforeChange(data.property);
+        }
         return;
     }
     if (data.property) {
@@ -556,4 +575,4 @@ TransactionObject* TransactionFactory::createTransaction(const Base::Type& type)
 
     Base::Console().log("Cannot create transaction object from %s\n", type.getName());
     return nullptr;
-}
\ No newline at end of file
+}
\ No newline at end of file
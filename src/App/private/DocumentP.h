@@ -99,6 +99,18 @@ struct DocumentP
     // as soon as there is a change to the document
     int bookedTransaction { 0 }; 
 
+    // Property changes deferred by an open change batch
+    struct BatchedChange
+    {
+        long objectId;
+        const Property* property;
+        int64_t propertyId;
+        bool changed;
+    };
+    int changeBatchDepth {0};
+    std::vector<BatchedChange> batchedChanges;
+    std::unordered_map<int64_t, std::size_t> batchedIndex;
+
     std::string programVersion;
     mutable HasherMap hashers;
     std::multimap<const App::DocumentObject*, std::unique_ptr<App::DocumentObjectExecReturn>>
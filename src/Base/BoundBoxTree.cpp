@@ -0,0 +1,148 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include <algorithm>
+#include <limits>
+
+#include "BoundBoxTree.h"
+
+using namespace Base;
+
+
+BoundBoxTree::BoundBoxTree(const std::vector<BoundBox3f>& boxes, std::size_t leafSize)
+{
+    if (boxes.empty()) {
+        return;
+    }
+
+    // the centers are partitioned together with the indices to keep the data to compare close
+    std::vector<Item> items;
+    items.reserve(boxes.size());
+    for (const auto& box : boxes) {
+        Vector3f center = box.GetCenter();
+        items.push_back({{center.x, center.y, center.z}, static_cast<std::uint32_t>(items.size())});
+    }
+
+    leafSize = std::max<std::size_t>(leafSize, 1);
+    // leaves are at least half full and there are less inner nodes than leaves
+    nodes.reserve(4 * (boxes.size() / leafSize + 1));
+    build(boxes, items, 0, static_cast<std::uint32_t>(items.size()), leafSize);
+
+    indices.reserve(items.size());
+    this->boxes.reserve(items.size());
+    for (const auto& item : items) {
+        indices.push_back(item.index);
+        this->boxes.push_back(boxes[item.index]);
+    }
+}
+
+std::uint32_t BoundBoxTree::build(
+    const std::vector<BoundBox3f>& input,
+    std::vector<Item>& items,
+    std::uint32_t begin,
+    std::uint32_t end,
+    std::size_t leafSize
+)
+{
+    auto nodeIndex = static_cast<std::uint32_t>(nodes.size());
+    nodes.emplace_back();
+
+    if (end - begin <= leafSize) {
+        BoundBox3f box;
+        for (std::uint32_t i = begin; i < end; ++i) {
+            box.Add(input[items[i].index]);
+        }
+        nodes[nodeIndex].box = box;
+        nodes[nodeIndex].first = begin;
+        nodes[nodeIndex].count = end - begin;
+        return nodeIndex;
+    }
+
+    BoundBox3f centerBox;
+    for (std::uint32_t i = begin; i < end; ++i) {
+        const auto& center = items[i].center;
+        centerBox.Add(Vector3f(center[0], center[1], center[2]));
+    }
+
+    // split at the median of the centers along the longest side, this keeps the tree balanced
+    // even if many primitives share the same center
+    int axis = 0;
+    float length = centerBox.LengthX();
+    if (centerBox.LengthY() > length) {
+        axis = 1;
+        length = centerBox.LengthY();
+    }
+    if (centerBox.LengthZ() > length) {
+        axis = 2;
+    }
+
+    std::uint32_t middle = begin + (end - begin) / 2;
+    std::nth_element(
+        items.begin() + begin,
+        items.begin() + middle,
+        items.begin() + end,
+        [axis](const Item& lhs, const Item& rhs) { return lhs.center[axis] < rhs.center[axis]; }
+    );
+
+    std::uint32_t first = build(input, items, begin, middle, leafSize);
+    std::uint32_t second = build(input, items, middle, end, leafSize);
+    BoundBox3f box = nodes[first].box;
+    box.Add(nodes[second].box);
+    nodes[nodeIndex].box = box;
+    nodes[nodeIndex].first = second;
+    return nodeIndex;
+}
+
+bool BoundBoxTree::isCutByRay(
+    const BoundBox3f& box,
+    const Vector3f& base,
+    const Vector3f& dir,
+    float tolerance
+)
+{
+    // slab test: intersect the parameter ranges in which the ray is between the planes of the
+    // box along each axis
+    const float minimum[3] = {box.MinX - tolerance, box.MinY - tolerance, box.MinZ - tolerance};
+    const float maximum[3] = {box.MaxX + tolerance, box.MaxY + tolerance, box.MaxZ + tolerance};
+    float tNear = 0.0F;
+    float tFar = std::numeric_limits<float>::max();
+    for (int i = 0; i < 3; ++i) {
+        if (dir[i] == 0.0F) {
+            if (base[i] < minimum[i] || base[i] > maximum[i]) {
+                return false;
+            }
+            continue;
+        }
+        float t1 = (minimum[i] - base[i]) / dir[i];
+        float t2 = (maximum[i] - base[i]) / dir[i];
+        if (t1 > t2) {
+            std::swap(t1, t2);
+        }
+        tNear = std::max(tNear, t1);
+        tFar = std::min(tFar, t2);
+        if (tNear > tFar) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,164 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <FCGlobal.h>
+
+#include "BoundBox.h"
+#include "Vector3D.h"
+
+
+namespace Base
+{
+
+/**
+ * A bounding volume hierarchy over the bounding boxes of primitives like triangles or line
+ * segments. It finds the primitives that may be hit by a ray, or that lie in any other region
+ * that can be tested against a box, without testing all of them.
+ *
+ * The tree only knows the boxes, the primitives are identified by the index of their box in the
+ * list the tree is built from. The caller keeps the geometry and does the exact test on the
+ * candidates.
+ */
+class BaseExport BoundBoxTree
+{
+public:
+    BoundBoxTree() = default;
+    /// Builds the tree over \a boxes with at most \a leafSize primitives per leaf.
+    explicit BoundBoxTree(const std::vector<BoundBox3f>& boxes, std::size_t leafSize = 4);
+
+    bool empty() const
+    {
+        return nodes.empty();
+    }
+    /// The number of primitives in the tree.
+    std::size_t size() const
+    {
+        return indices.size();
+    }
+    /// The box of all primitives.
+    BoundBox3f getBoundBox() const
+    {
+        return nodes.empty() ? BoundBox3f() : nodes.front().box;
+    }
+
+    /**
+     * Calls \a visit with the index of every primitive whose box, and the boxes of all nodes
+     * above it, pass \a test. Traversal stops when \a visit returns false.
+     */
+    template<typename Test, typename Visit>
+    void traverse(Test&& test, Visit&& visit) const
+    {
+        if (nodes.empty()) {
+            return;
+        }
+        std::vector<std::uint32_t> stack;
+        stack.reserve(64);
+        stack.push_back(0);
+        while (!stack.empty()) {
+            const Node& node = nodes[stack.back()];
+            std::uint32_t index = stack.back();
+            stack.pop_back();
+            if (!test(node.box)) {
+                continue;
+            }
+            if (node.count > 0) {
+                for (std::uint32_t i = node.first; i < node.first + node.count; ++i) {
+                    if (!test(boxes[i])) {
+                        continue;
+                    }
+                    if (!visit(static_cast<std::size_t>(indices[i]))) {
+                        return;
+                    }
+                }
+            }
+            else {
+                stack.push_back(node.first);
+                stack.push_back(index + 1);
+            }
+        }
+    }
+
+    /**
+     * Calls \a visit with the index of every primitive whose box is cut by the ray starting
+     * at \a base in the direction \a dir, grown by \a tolerance.
+     */
+    template<typename Visit>
+    void traverseRay(
+        const Vector3f& base,
+        const Vector3f& dir,
+        Visit&& visit,
+        float tolerance = 0.0F
+    ) const
+    {
+        traverse(
+            [&](const BoundBox3f& box) { return isCutByRay(box, base, dir, tolerance); },
+            std::forward<Visit>(visit)
+        );
+    }
+
+    /// Checks whether the ray starting at \a base in the direction \a dir cuts \a box.
+    static bool isCutByRay(
+        const BoundBox3f& box,
+        const Vector3f& base,
+        const Vector3f& dir,
+        float tolerance = 0.0F
+    );
+
+private:
+    struct Node
+    {
+        BoundBox3f box;
+        // A leaf holds count primitives starting at first, an inner node has its first child
+        // right after itself and its second child at first.
+        std::uint32_t first {0};
+        std::uint32_t count {0};
+    };
+
+    struct Item
+    {
+        std::array<float, 3> center;
+        std::uint32_t index;
+    };
+
+    std::uint32_t build(
+        const std::vector<BoundBox3f>& input,
+        std::vector<Item>& items,
+        std::uint32_t begin,
+        std::uint32_t end,
+        std::size_t leafSize
+    );
+
+    std::vector<Node> nodes;
+    // the primitive indices in leaf order and their boxes
+    std::vector<std::uint32_t> indices;
+    std::vector<BoundBox3f> boxes;
+};
+
+}  // namespace Base
@@ -3032,6 +3032,13 @@ static std::vector<std::string> getBoxSelection(
             return ret;
         }
         Base::PyGILStateLocker lock;
+        // Let the view provider find the elements in its tessellation, which is much faster
+        // than projecting the geometry of every element one by one.
+        Base::Matrix4D vpMat(mat);
+        obj->getSubObject(nullptr, nullptr, &vpMat, transform, depth);
+        if (vp->getElementsInPolygon(proj, polygon, vpMat, mode == CENTER, ret)) {
+            return ret;
+        }
         PyObject* pyobj = nullptr;
         Base::Matrix4D matCopy(mat);
         obj->getSubObject(nullptr, &pyobj, &matCopy, transform, depth);
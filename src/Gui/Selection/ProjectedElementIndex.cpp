@@ -0,0 +1,378 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+#include <QtConcurrentMap>
+
+#include <Base/Matrix.h>
+#include <Base/Tools2D.h>
+#include <Base/ViewProj.h>
+
+#include "ProjectedElementIndex.h"
+
+
+using namespace Gui;
+
+namespace
+{
+
+/// Calls \a func with the sub-ranges of [0, count) in parallel.
+template<typename Func>
+void parallelFor(std::size_t count, Func func)
+{
+    constexpr std::size_t chunkSize = 1024;
+    if (count <= chunkSize) {
+        func(std::size_t(0), count);
+        return;
+    }
+
+    std::vector<std::pair<std::size_t, std::size_t>> chunks;
+    for (std::size_t i = 0; i < count; i += chunkSize) {
+        chunks.emplace_back(i, std::min(i + chunkSize, count));
+    }
+    QtConcurrent::blockingMap(chunks, [&func](const std::pair<std::size_t, std::size_t>& chunk) {
+        func(chunk.first, chunk.second);
+    });
+}
+
+/**
+ * Divides the bounding box of a polygon into cells that are completely inside the polygon,
+ * completely outside of it or cut by its border. Only points in the cells of the border need
+ * the exact test against the polygon.
+ */
+class PolygonGrid
+{
+public:
+    enum Cell : std::uint8_t
+    {
+        Outside,
+        Inside,
+        Border
+    };
+
+    explicit PolygonGrid(const Base::Polygon2d& polygon)
+        : polygon(polygon)
+        , bbox(polygon.CalcBoundBox())
+        , cells(GridSize * GridSize, Outside)
+    {
+        cellWidth = std::max(bbox.Width() / GridSize, std::numeric_limits<double>::epsilon());
+        cellHeight = std::max(bbox.Height() / GridSize, std::numeric_limits<double>::epsilon());
+
+        std::size_t count = polygon.GetCtVectors();
+        for (std::size_t i = 0; i < count; ++i) {
+            markBorder(polygon[i], polygon[(i + 1) % count]);
+        }
+
+        // a cell that is not cut by the border is either completely inside or outside
+        for (int row = 0; row < GridSize; ++row) {
+            for (int col = 0; col < GridSize; ++col) {
+                Cell& cell = cells[row * GridSize + col];
+                if (cell == Border) {
+                    continue;
+                }
+                Base::Vector2d center(
+                    bbox.MinX + (col + 0.5) * cellWidth,
+                    bbox.MinY + (row + 0.5) * cellHeight
+                );
+                cell = polygon.Contains(center) ? Inside : Outside;
+            }
+        }
+    }
+
+    bool contains(const Base::Vector2d& v) const
+    {
+        if (!bbox.Contains(v)) {
+            return false;
+        }
+        switch (cells[row(v.y) * GridSize + column(v.x)]) {
+            case Inside:
+                return true;
+            case Outside:
+                return false;
+            default:
+                return polygon.Contains(v);
+        }
+    }
+
+    /// Returns whether \a box is completely outside or inside the polygon, or Border if unsure.
+    Cell classify(const Base::BoundBox2d& box) const
+    {
+        if (box.MaxX < bbox.MinX || box.MinX > bbox.MaxX || box.MaxY < bbox.MinY
+            || box.MinY > bbox.MaxY) {
+            return Outside;
+        }
+
+        bool inside = false;
+        bool outside = false;
+        for (int r = row(box.MinY); r <= row(box.MaxY); ++r) {
+            for (int c = column(box.MinX); c <= column(box.MaxX); ++c) {
+                switch (cells[r * GridSize + c]) {
+                    case Inside:
+                        inside = true;
+                        break;
+                    case Outside:
+                        outside = true;
+                        break;
+                    default:
+                        return Border;
+                }
+            }
+        }
+        if (!inside) {
+            return Outside;
+        }
+        bool inBox = box.MinX >= bbox.MinX && box.MaxX <= bbox.MaxX && box.MinY >= bbox.MinY
+            && box.MaxY <= bbox.MaxY;
+        return !outside && inBox ? Inside : Border;
+    }
+
+private:
+    static constexpr int GridSize = 64;
+
+    int column(double x) const
+    {
+        int index = static_cast<int>(std::floor((x - bbox.MinX) / cellWidth));
+        return std::clamp(index, 0, GridSize - 1);
+    }
+    int row(double y) const
+    {
+        int index = static_cast<int>(std::floor((y - bbox.MinY) / cellHeight));
+        return std::clamp(index, 0, GridSize - 1);
+    }
+
+    void markBorder(Base::Vector2d a, Base::Vector2d b)
+    {
+        if (a.x > b.x) {
+            std::swap(a, b);
+        }
+        double dx = b.x - a.x;
+        for (int c = column(a.x); c <= column(b.x); ++c) {
+            // the part of the segment inside this column
+            double x0 = std::max(a.x, bbox.MinX + c * cellWidth);
+            double x1 = std::min(b.x, bbox.MinX + (c + 1) * cellWidth);
+            double y0 = a.y;
+            double y1 = b.y;
+            if (dx > 0.0) {
+                y0 = a.y + (x0 - a.x) * (b.y - a.y) / dx;
+                y1 = a.y + (x1 - a.x) * (b.y - a.y) / dx;
+            }
+            for (int r = row(std::min(y0, y1)); r <= row(std::max(y0, y1)); ++r) {
+                cells[r * GridSize + c] = Border;
+            }
+        }
+    }
+
+    const Base::Polygon2d& polygon;
+    Base::BoundBox2d bbox;
+    double cellWidth {};
+    double cellHeight {};
+    std::vector<Cell> cells;
+};
+
+double cross(const Base::Vector2d& a, const Base::Vector2d& b, const Base::Vector2d& c)
+{
+    return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+}
+
+bool segmentsCross(
+    const Base::Vector2d& p0,
+    const Base::Vector2d& p1,
+    const Base::Vector2d& q0,
+    const Base::Vector2d& q1
+)
+{
+    double d0 = cross(p0, p1, q0);
+    double d1 = cross(p0, p1, q1);
+    double d2 = cross(q0, q1, p0);
+    double d3 = cross(q0, q1, p1);
+    return ((d0 <= 0.0 && d1 >= 0.0) || (d0 >= 0.0 && d1 <= 0.0))
+        && ((d2 <= 0.0 && d3 >= 0.0) || (d2 >= 0.0 && d3 <= 0.0)) && (d0 != d1 || d2 != d3);
+}
+
+bool triangleContains(
+    const Base::Vector2d& a,
+    const Base::Vector2d& b,
+    const Base::Vector2d& c,
+    const Base::Vector2d& v
+)
+{
+    double d0 = cross(a, b, v);
+    double d1 = cross(b, c, v);
+    double d2 = cross(c, a, v);
+    bool negative = d0 < 0.0 || d1 < 0.0 || d2 < 0.0;
+    bool positive = d0 > 0.0 || d1 > 0.0 || d2 > 0.0;
+    return !(negative && positive);
+}
+
+bool intersectsTriangle(
+    const PolygonGrid& grid,
+    const Base::Polygon2d& polygon,
+    const std::array<Base::Vector2d, 3>& tria
+)
+{
+    Base::BoundBox2d box;
+    for (const auto& v : tria) {
+        box.Add(v);
+    }
+    switch (grid.classify(box)) {
+        case PolygonGrid::Outside:
+            return false;
+        case PolygonGrid::Inside:
+            return true;
+        default:
+            break;
+    }
+
+    for (const auto& v : tria) {
+        if (grid.contains(v)) {
+            return true;
+        }
+    }
+
+    // the polygon may lie inside the triangle or cross it without a corner inside
+    std::size_t count = polygon.GetCtVectors();
+    for (std::size_t i = 0; i < count; ++i) {
+        const Base::Vector2d& p0 = polygon[i];
+        const Base::Vector2d& p1 = polygon[(i + 1) % count];
+        if (box.Contains(p0) && triangleContains(tria[0], tria[1], tria[2], p0)) {
+            return true;
+        }
+        for (std::size_t j = 0; j < 3; ++j) {
+            if (segmentsCross(p0, p1, tria[j], tria[(j + 1) % 3])) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+}  // namespace
+
+ProjectedElementIndex::ProjectedElementIndex(
+    const char* type,
+    Primitive primitive,
+    std::vector<Base::Vector3f> points
+)
+    : type(type)
+    , primitive(primitive)
+    , points(std::move(points))
+{}
+
+void ProjectedElementIndex::addElement(const std::int32_t* indices, std::size_t count)
+{
+    this->indices.insert(this->indices.end(), indices, indices + count);
+    offsets.push_back(static_cast<std::uint32_t>(this->indices.size()));
+}
+
+std::vector<std::string> ProjectedElementIndex::select(
+    const Base::ViewProjMethod& proj,
+    const Base::Matrix4D& mat,
+    const Base::Polygon2d& polygon,
+    bool center
+) const
+{
+    std::vector<std::string> result;
+    if (empty() || polygon.GetCtVectors() < 3) {
+        return result;
+    }
+
+    std::vector<Base::Vector2d> screen(points.size());
+    parallelFor(points.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            const Base::Vector3f& p = points[i];
+            Base::Vector3d v = proj(mat * Base::Vector3d(p.x, p.y, p.z));
+            screen[i] = Base::Vector2d(v.x, v.y);
+        }
+    });
+
+    PolygonGrid grid(polygon);
+    auto isSelected = [&](std::size_t element) {
+        std::uint32_t begin = offsets[element];
+        std::uint32_t end = offsets[element + 1];
+        if (begin == end) {
+            return false;
+        }
+        if (primitive == Primitive::Points) {
+            return grid.contains(screen[indices[begin]]);
+        }
+
+        Base::BoundBox2d box;
+        for (std::uint32_t i = begin; i < end; ++i) {
+            box.Add(screen[indices[i]]);
+        }
+        PolygonGrid::Cell cell = grid.classify(box);
+        if (cell == PolygonGrid::Outside) {
+            return false;
+        }
+        if (center && !grid.contains(box.GetCenter())) {
+            return false;
+        }
+        if (cell == PolygonGrid::Inside) {
+            return true;
+        }
+
+        if (primitive == Primitive::Polylines) {
+            // test the polyline as a closed loop like the geometry of an edge is tested
+            Base::Polygon2d loop;
+            for (std::uint32_t i = begin; i < end; ++i) {
+                if (grid.contains(screen[indices[i]])) {
+                    return true;
+                }
+                loop.Add(screen[indices[i]]);
+            }
+            return polygon.Intersect(loop);
+        }
+
+        for (std::uint32_t i = begin; i + 2 < end; i += 3) {
+            std::array<Base::Vector2d, 3> tria {
+                screen[indices[i]],
+                screen[indices[i + 1]],
+                screen[indices[i + 2]]
+            };
+            if (intersectsTriangle(grid, polygon, tria)) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    std::vector<char> selected(size(), 0);
+    parallelFor(size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            selected[i] = isSelected(i) ? 1 : 0;
+        }
+    });
+
+    for (std::size_t i = 0; i < selected.size(); ++i) {
+        if (selected[i]) {
+            result.push_back(type + std::to_string(i + 1));
+        }
+    }
+    return result;
+}
@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <Base/Vector3D.h>
+#include <FCGlobal.h>
+
+namespace Base
+{
+class Matrix4D;
+class Polygon2d;
+class ViewProjMethod;
+}  // namespace Base
+
+namespace Gui
+{
+
+/**
+ * Finds the sub-elements of a shape that lie in a selection polygon on the screen, using the
+ * tessellation a view provider renders instead of the geometry of every single element.
+ *
+ * All elements have the same type and are numbered in the order they are added, starting at 1,
+ * so that the names returned by select() are e.g. "Face1", "Face2", ... An element is given by
+ * the indices of its points, which are the corners of its triangles for a face, its polyline
+ * for an edge or its single point for a vertex.
+ */
+class GuiExport ProjectedElementIndex
+{
+public:
+    enum class Primitive
+    {
+        Points,
+        Polylines,
+        Triangles
+    };
+
+    ProjectedElementIndex() = default;
+    ProjectedElementIndex(
+        const char* type,
+        Primitive primitive,
+        std::vector<Base::Vector3f> points
+    );
+
+    /// Appends the next element made of the points with the given \a indices.
+    void addElement(const std::int32_t* indices, std::size_t count);
+
+    bool empty() const
+    {
+        return offsets.size() < 2;
+    }
+    /// The number of elements.
+    std::size_t size() const
+    {
+        return offsets.size() - 1;
+    }
+    const std::string& getType() const
+    {
+        return type;
+    }
+
+    /**
+     * Returns the names of the elements that \a polygon selects, in ascending order. The points
+     * are transformed by \a mat and projected to the screen by \a proj. If \a center is true an
+     * element must intersect the polygon and have the center of its projected bounding box
+     * inside, otherwise it is enough that it intersects the polygon. A vertex is selected if it
+     * lies inside the polygon.
+     */
+    std::vector<std::string> select(
+        const Base::ViewProjMethod& proj,
+        const Base::Matrix4D& mat,
+        const Base::Polygon2d& polygon,
+        bool center
+    ) const;
+
+private:
+    std::string type;
+    Primitive primitive {Primitive::Points};
+    std::vector<Base::Vector3f> points;
+    // element i uses the point indices in [offsets[i], offsets[i + 1])
+    std::vector<std::uint32_t> offsets {0};
+    std::vector<std::int32_t> indices;
+};
+
+}  // namespace Gui
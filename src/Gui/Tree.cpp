@@ -93,6 +93,9 @@ const int TreeWidget::DocumentType = 1000;
 const int TreeWidget::ObjectType = 1001;
 static bool _DraggingActive;
 static bool _DragEventFilter;
+// Time in ms a status update may spend on creating items and testing their
+// status before it continues in the next frame
+static const qint64 _StatusFrameTime = 20;
 
 static bool isVisibilityIconEnabled()
 {
@@ -1158,10 +1161,14 @@ void TreeWidget::_updateStatus(bool delay)
 
     if (!delay) {
         if (!ChangedObjects.empty() || !NewObjects.empty()) {
-            onUpdateStatus();
+            doUpdateStatus(false);
         }
         return;
     }
+    statusRequested = true;
+    for (auto& v : DocumentMap) {
+        v.second->statusStale = true;
+    }
     int timeout = TreeParams::getStatusTimeout();
     if (timeout < 0) {
         timeout = 1;
@@ -3442,6 +3449,11 @@ struct UpdateDisabler
 };
 
 void TreeWidget::onUpdateStatus()
+{
+    doUpdateStatus(true);
+}
+
+void TreeWidget::doUpdateStatus(bool incremental)
 {
     if (this->state() == DraggingState || App::GetApplication().isRestoring()) {
         _updateStatus();
@@ -3464,6 +3476,16 @@ void TreeWidget::onUpdateStatus()
 
     UpdateDisabler disabler(*this, updateBlocked);
 
+    // An incremental update creates items and tests their status only as long
+    // as it fits in a frame, and continues with the rest in the next frames.
+    QElapsedTimer frame;
+    frame.start();
+    auto timeIsUp = [&]() {
+        return incremental && frame.hasExpired(_StatusFrameTime);
+    };
+    bool requested = !incremental || statusRequested;
+    statusRequested = false;
+
     std::vector<App::DocumentObject*> errors;
 
     // Use a local copy in case of nested calls
@@ -3471,7 +3493,13 @@ void TreeWidget::onUpdateStatus()
     NewObjects.clear();
 
     // Checking for new objects
+    bool pendingNewObjects = false;
     for (auto& v : localNewObjects) {
+        if (pendingNewObjects) {
+            auto& pending = NewObjects[v.first];
+            pending.insert(pending.begin(), v.second.begin(), v.second.end());
+            continue;
+        }
         auto doc = App::GetApplication().getDocument(v.first.c_str());
         if (!doc) {
             continue;
@@ -3484,8 +3512,14 @@ void TreeWidget::onUpdateStatus()
         if (!docItem) {
             continue;
         }
-        for (auto id : v.second) {
-            auto obj = doc->getObjectByID(id);
+        for (auto it = v.second.begin(); it != v.second.end(); ++it) {
+            if (timeIsUp()) {
+                auto& pending = NewObjects[v.first];
+                pending.insert(pending.begin(), it, v.second.end());
+                pendingNewObjects = true;
+                break;
+            }
+            auto obj = doc->getObjectByID(*it);
             if (!obj) {
                 continue;
             }
@@ -3502,6 +3536,17 @@ void TreeWidget::onUpdateStatus()
         }
     }
 
+    if (pendingNewObjects) {
+        // The rest of the update runs once all items are created, keep the
+        // errors found so far for it
+        for (auto obj : errors) {
+            ChangedObjects[obj].set(CS_Error);
+        }
+        statusRequested = statusRequested || requested;
+        statusTimer->start(0);
+        return;
+    }
+
     // Use a local copy in case of nested calls
     auto localChangedObjects = ChangedObjects;
     ChangedObjects.clear();
@@ -3539,8 +3584,25 @@ void TreeWidget::onUpdateStatus()
     }
 
     FC_LOG("update item status");
+    bool statusDone = true;
     for (auto pos = DocumentMap.begin(); pos != DocumentMap.end(); ++pos) {
-        pos->second->testStatus();
+        if (incremental) {
+            statusDone = pos->second->testStatus(frame) && statusDone;
+        }
+        else {
+            pos->second->testStatus();
+        }
+    }
+
+    if (!requested) {
+        // Nothing changed since the last frame, only testing the status was left
+        if (statusDone) {
+            statusTimer->stop();
+        }
+        else {
+            statusTimer->start(0);
+        }
+        return;
     }
 
     // Checking for just restored documents
@@ -3641,7 +3703,12 @@ void TreeWidget::onUpdateStatus()
     }
 
     updateGeometries();
-    statusTimer->stop();
+    if (statusDone) {
+        statusTimer->stop();
+    }
+    else {
+        statusTimer->start(0);
+    }
 
     FC_LOG("done update status");
 }
@@ -5420,11 +5487,36 @@ Gui::Document* DocumentItem::document() const
 
 void DocumentItem::testStatus()
 {
+    StatusObjects.clear();
+    statusStale = false;
     for (const auto& v : ObjectMap) {
         v.second->testStatus();
     }
 }
 
+bool DocumentItem::testStatus(const QElapsedTimer& frame)
+{
+    if (StatusObjects.empty()) {
+        if (!statusStale) {
+            return true;
+        }
+        statusStale = false;
+        StatusObjects.reserve(ObjectMap.size());
+        for (const auto& v : ObjectMap) {
+            StatusObjects.push_back(v.first);
+        }
+    }
+    while (!StatusObjects.empty() && !frame.hasExpired(_StatusFrameTime)) {
+        // The object may have been deleted since the pass started
+        auto it = ObjectMap.find(StatusObjects.back());
+        StatusObjects.pop_back();
+        if (it != ObjectMap.end()) {
+            it->second->testStatus();
+        }
+    }
+    return StatusObjects.empty() && !statusStale;
+}
+
 void DocumentItem::setData(int column, int role, const QVariant& value)
 {
     if (role == Qt::EditRole) {
@@ -261,6 +261,8 @@ private:
         bool force
     );
 
+    void doUpdateStatus(bool incremental);
+
     bool CheckForDependents();
     void addDependentToSelection(App::Document* doc, App::DocumentObject* docObject);
     static TreeWidget* getTreeForSelection();
@@ -314,6 +316,9 @@ private:
 
     std::string myName;  // for debugging purpose
     int updateBlocked = 0;
+    // Whether a status update was asked for since the last one, as opposed to
+    // a status update continuing the work of the previous frame
+    bool statusRequested = false;
 
     // State tracking for the two-stage "Select All" operation
     bool lastSelectAllParent = false;   // true if last select was group-level, used for double-tap
@@ -362,6 +367,7 @@ public:
     void selectItems(SelectionReason reason = SR_SELECT);
 
     void testStatus();
+    bool testStatus(const QElapsedTimer& frame);
     void setData(int column, int role, const QVariant& value) override;
     void populateItem(DocumentObjectItem* item, bool refresh = false, bool delayUpdate = true);
     bool populateObject(App::DocumentObject* obj);
@@ -452,6 +458,9 @@ private:
     std::unordered_map<App::DocumentObject*, DocumentObjectDataPtr> ObjectMap;
     std::unordered_map<App::DocumentObject*, std::set<App::DocumentObject*>> _ParentMap;
     std::vector<App::DocumentObject*> PopulateObjects;
+    // Objects whose item status is still to be tested in the current pass
+    std::vector<App::DocumentObject*> StatusObjects;
+    bool statusStale = true;
 
     ExpandInfoPtr _ExpandInfo;
     void restoreItemExpansion(const ExpandInfoPtr&, DocumentObjectItem*);
@@ -59,6 +59,8 @@ namespace Base
 {
 class Matrix4D;
 class Color;
+class Polygon2d;
+class ViewProjMethod;
 }  // namespace Base
 
 class SoGroup;
@@ -326,6 +328,34 @@ public:
         return {};
     }
 
+    /** Return the sub-elements inside a selection polygon
+     *
+     * @param proj: the projection of the view
+     * @param polygon: the selection polygon in the projected space
+     * @param mat: the transformation of the geometry of this view provider
+     * @param center: if true, the center of an element must be inside the polygon,
+     * otherwise it is enough that the element intersects it
+     * @param elements: output the names of the selected elements like "Face1"
+     *
+     * @return false if the view provider cannot find the elements on its own, in which
+     * case the caller has to test the geometry of every element.
+     */
+    virtual bool getElementsInPolygon(
+        const Base::ViewProjMethod& proj,
+        const Base::Polygon2d& polygon,
+        const Base::Matrix4D& mat,
+        bool center,
+        std::vector<std::string>& elements
+    ) const
+    {
+        (void)proj;
+        (void)polygon;
+        (void)mat;
+        (void)center;
+        (void)elements;
+        return false;
+    }
+
     /** Return the bound box of this view object
      *
      * This method shall work regardless whether the current view object is
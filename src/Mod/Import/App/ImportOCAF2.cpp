@@ -35,6 +35,7 @@
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS_Iterator.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 #include <XCAFDoc_DocumentTool.hxx>
 #include <XCAFDoc_GraphNode.hxx>
 #include <XCAFDoc_ShapeTool.hxx>
@@ -102,6 +103,7 @@ ImportOCAFOptions ImportOCAF2::customImportOptions()
     defaultOptions.useBaseName = settings.getUseBaseName();
     defaultOptions.importHidden = settings.getImportHiddenObject();
     defaultOptions.reduceObjects = settings.getReduceObjects();
+    defaultOptions.instanceLinks = settings.getInstanceLinks();
     defaultOptions.showProgress = settings.getShowProgress();
     defaultOptions.expandCompound = settings.getExpandCompound();
     defaultOptions.mode = static_cast<int>(settings.getImportMode());
@@ -516,19 +518,40 @@ App::DocumentObject* ImportOCAF2::loadShapes()
         Tools::dumpLabels(pDoc->Main(), aShapeTool, aColorTool);
     }
 
+    // Every free shape and every component of an assembly is loaded once, the progress steps
+    // through them so that importing large assemblies can be followed and cancelled
     TDF_LabelSequence labels;
     aShapeTool->GetShapes(labels);
-    Base::SequencerLauncher seq("Importing...", labels.Length());
+    int steps = 0;
+    for (Standard_Integer i = 1; i <= labels.Length(); i++) {
+        if (aShapeTool->IsAssembly(labels.Value(i))) {
+            steps += XCAFDoc_ShapeTool::NbComponents(labels.Value(i), Standard_False);
+        }
+    }
+    labels.Clear();
+    aShapeTool->GetFreeShapes(labels);
+    steps += labels.Length();
     FC_LOG("free shape count " << labels.Length());
+
+    Base::SequencerLauncher seq("Importing...", options.showProgress ? steps : 0);
     sequencer = options.showProgress ? &seq : nullptr;
+    try {
+        return loadFreeShapes(labels);
+    }
+    catch (...) {
+        sequencer = nullptr;
+        throw;
+    }
+}
 
-    labels.Clear();
+App::DocumentObject* ImportOCAF2::loadFreeShapes(const TDF_LabelSequence& labels)
+{
     myShapes.clear();
     myNames.clear();
     myCollapsedObjects.clear();
+    instanceStats = InstanceStats();
 
     std::vector<App::DocumentObject*> objs;
-    aShapeTool->GetFreeShapes(labels);
     boost::dynamic_bitset<> vis;
     int count = 0;
     for (Standard_Integer i = 1; i <= labels.Length(); i++) {
@@ -583,10 +606,30 @@ App::DocumentObject* ImportOCAF2::loadShapes()
         ret = feature;
         ret->recomputeFeature(true);
     }
+    if (options.instanceLinks) {
+        reportInstances();
+    }
     sequencer = nullptr;
     return ret;
 }
 
+void ImportOCAF2::addInstances(const Info& info, int count)
+{
+    instanceStats.instances += count;
+    instanceStats.instanceFaces += info.faceCount * count;
+}
+
+void ImportOCAF2::reportInstances() const
+{
+    Base::Console().message(
+        "Import: %d instances of %d unique shapes, %d of %d faces are shared instead of copied\n",
+        instanceStats.instances,
+        instanceStats.uniqueShapes,
+        instanceStats.instanceFaces - instanceStats.uniqueFaces,
+        instanceStats.instanceFaces
+    );
+}
+
 void ImportOCAF2::getSHUOColors(TDF_Label label, std::map<std::string, Base::Color>& colors, bool appendFirst)
 {
     TDF_AttributeSequence seq;
@@ -662,15 +705,16 @@ App::DocumentObject* ImportOCAF2::loadShape(
     if (shape.IsNull()) {
         return nullptr;
     }
+    if (sequencer) {
+        // throws Base::AbortException if the user cancels the import
+        sequencer->next(true);
+    }
 
     auto baseShape = shape.Located(TopLoc_Location());
     auto it = myShapes.find(baseShape);
     if (it == myShapes.end()) {
         Info info;
         auto baseLabel = aShapeTool->FindShape(baseShape);
-        if (sequencer && !baseLabel.IsNull() && aShapeTool->IsTopLevel(baseLabel)) {
-            sequencer->next(true);
-        }
         bool res;
         if (baseLabel.IsNull() || !aShapeTool->IsAssembly(baseLabel)) {
             res = createObject(doc, baseLabel, baseShape, info, newDoc);
@@ -682,6 +726,15 @@ App::DocumentObject* ImportOCAF2::loadShape(
             return nullptr;
         }
         setObjectName(info, baseLabel);
+        if (options.instanceLinks) {
+            if (baseLabel.IsNull() || !aShapeTool->IsAssembly(baseLabel)) {
+                TopTools_IndexedMapOfShape faces;
+                TopExp::MapShapes(baseShape, TopAbs_FACE, faces);
+                info.faceCount = faces.Extent();
+                ++instanceStats.uniqueShapes;
+                instanceStats.uniqueFaces += info.faceCount;
+            }
+        }
         it = myShapes.emplace(baseShape, info).first;
     }
     if (baseOnly) {
@@ -696,7 +749,9 @@ App::DocumentObject* ImportOCAF2::loadShape(
     auto info = it->second;
     getColor(shape, info, true);
 
-    if (shuoColors.empty() && info.free && doc == info.obj->getDocument()) {
+    // In instance link mode every component is a link, only free shapes use the object itself
+    bool isInstance = options.instanceLinks && !label.IsNull() && aShapeTool->IsComponent(label);
+    if (shuoColors.empty() && info.free && !isInstance && doc == info.obj->getDocument()) {
         it->second.free = false;
         auto name = getLabelName(label);
         if (info.faceColor != it->second.faceColor || info.edgeColor != it->second.edgeColor
@@ -721,6 +776,11 @@ App::DocumentObject* ImportOCAF2::loadShape(
     auto link = doc->addObject<App::Link>("Link");
     link->setLink(-1, info.obj);
     setPlacement(&link->Placement, shape);
+    addInstances(info, 1);
+    if (isInstance) {
+        // The object is only shown through the links to its instances
+        info.obj->Visibility.setValue(false);
+    }
     info.obj = link;
     setObjectName(info, label);
     if (info.faceColor != it->second.faceColor) {
@@ -840,6 +900,13 @@ bool ImportOCAF2::createAssembly(
             }
             link->PlacementList.setValue(childInfo.plas);
             link->VisibilityList.setValue(childInfo.vis);
+            auto jt = myShapes.find(childInfo.shape.Located(TopLoc_Location()));
+            if (jt != myShapes.end()) {
+                addInstances(jt->second, static_cast<int>(childInfo.plas.size()));
+            }
+            if (options.instanceLinks) {
+                child->Visibility.setValue(false);
+            }
 
             for (auto& v : childInfo.colors) {
                 applyLinkColor(link, v.first, v.second);
@@ -69,6 +69,7 @@ struct ImportExport ImportOCAFOptions
     bool useBaseName = true;
     bool importHidden = true;
     bool reduceObjects = false;
+    bool instanceLinks = false;
     bool showProgress = false;
     bool expandCompound = false;
     int mode = 0;
@@ -100,6 +101,11 @@ public:
     {
         options.reduceObjects = enable;
     }
+    /// Create one object per unique shape and an App::Link for each of its placements
+    void setInstanceLinks(bool enable)
+    {
+        options.instanceLinks = enable;
+    }
     void setShowProgress(bool enable)
     {
         options.showProgress = enable;
@@ -135,8 +141,10 @@ private:
         bool hasFaceColor = false;
         bool hasEdgeColor = false;
         int free = true;
+        int faceCount = 0;
     };
 
+    App::DocumentObject* loadFreeShapes(const TDF_LabelSequence& labels);
     App::DocumentObject* loadShape(
         App::Document* doc,
         TDF_Label label,
@@ -214,6 +222,18 @@ private:
     std::unordered_map<TDF_Label, std::string, LabelHasher> myNames;
     std::unordered_map<App::DocumentObject*, App::PropertyPlacement*> myCollapsedObjects;
 
+    /// Statistics of the instance link mode
+    struct InstanceStats
+    {
+        int uniqueShapes = 0;
+        int uniqueFaces = 0;
+        int instances = 0;
+        int instanceFaces = 0;
+    };
+    InstanceStats instanceStats;
+    void addInstances(const Info& info, int count);
+    void reportInstances() const;
+
     Base::SequencerLauncher* sequencer {nullptr};
 };
 
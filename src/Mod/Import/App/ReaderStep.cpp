@@ -22,6 +22,8 @@
  **************************************************************************/
 
 
+#include <Message_ProgressIndicator.hxx>
+#include <Message_ProgressScope.hxx>
 #include <Standard_Version.hxx>
 #include <STEPCAFControl_Reader.hxx>
 #include <Transfer_TransientProcess.hxx>
@@ -30,11 +32,48 @@
 
 
 #include "ReaderStep.h"
+#include <Base/Console.h>
 #include <Base/Exception.h>
+#include <Base/Sequencer.h>
 #include <Mod/Part/App/encodeFilename.h>
 
 using namespace Import;
 
+namespace
+{
+
+#if OCC_VERSION_HEX >= 0x070600
+// Forwards the OCCT progress of a stage to the sequencer so that it is shown
+// in the GUI and can be cancelled there.
+class SequencerProgress: public Message_ProgressIndicator
+{
+public:
+    explicit SequencerProgress(Base::SequencerLauncher& seq)
+        : seq(seq)
+    {}
+
+    Standard_Boolean UserBreak() override
+    {
+        return seq.wasCanceled();
+    }
+
+    void Show(const Message_ProgressScope& scope, const Standard_Boolean /*isForce*/) override
+    {
+        if (!scope.IsInfinite()) {
+            auto steps = static_cast<double>(seq.numberOfSteps());
+            seq.setProgress(static_cast<size_t>(GetPosition() * steps));
+        }
+    }
+
+private:
+    Base::SequencerLauncher& seq;
+};
+#endif
+
+const size_t ProgressSteps = 100;
+
+}  // namespace
+
 ReaderStep::ReaderStep(const Base::FileInfo& file)  // NOLINT
     : file {file}
 {
@@ -44,14 +83,23 @@ ReaderStep::ReaderStep(const Base::FileInfo& file)  // NOLINT
 }
 
 void ReaderStep::read(Handle(TDocStd_Document) hDoc)  // NOLINT
+{
+    parse();
+    transfer(hDoc);
+}
+
+void ReaderStep::parse()
 {
     std::string utf8Name = file.filePath();
     std::string name8bit = Part::encodeFilename(utf8Name);
-    STEPCAFControl_Reader aReader;
     aReader.SetColorMode(true);
     aReader.SetNameMode(true);
     aReader.SetLayerMode(true);
     aReader.SetSHUOMode(true);
+
+    // OCCT neither reports progress nor can be interrupted while parsing, so only a busy
+    // indicator is shown and the import can only be cancelled from the transfer on
+    Base::SequencerLauncher seq("Reading STEP file...", 0);
 #if OCC_VERSION_HEX < 0x070800
     if (aReader.ReadFile(name8bit.c_str()) != IFSelect_RetDone) {
 #else
@@ -63,5 +111,29 @@ void ReaderStep::read(Handle(TDocStd_Document) hDoc)  // NOLINT
         throw Base::FileException("Cannot read STEP file", file);
     }
 
-    aReader.Transfer(hDoc);
+    parsed = true;
+    Base::Console().log("STEP: %d roots to transfer\n", aReader.NbRootsForTransfer());
+}
+
+void ReaderStep::transfer(Handle(TDocStd_Document) hDoc)  // NOLINT
+{
+    if (!parsed) {
+        parse();
+    }
+
+    // Shared sub-assemblies and parts are transferred once by OCCT and referenced from every
+    // instance, which ImportOCAF2 keeps when creating the document objects.
+    Base::SequencerLauncher seq("Transferring STEP shapes...", ProgressSteps);
+#if OCC_VERSION_HEX >= 0x070600
+    Handle(SequencerProgress) progress = new SequencerProgress(seq);
+    bool done = aReader.Transfer(hDoc, progress->Start());
+#else
+    bool done = aReader.Transfer(hDoc);
+#endif
+    if (seq.wasCanceled()) {
+        throw Base::AbortException("STEP import aborted");
+    }
+    if (!done) {
+        Base::Console().warning("STEP: transfer of '%s' is incomplete\n", file.filePath().c_str());
+    }
 }
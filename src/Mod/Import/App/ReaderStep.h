@@ -26,6 +26,7 @@
 #include <Mod/Import/ImportGlobal.h>
 #include <Base/FileInfo.h>
 #include <Resource_FormatType.hxx>
+#include <STEPCAFControl_Reader.hxx>
 #include <TDocStd_Document.hxx>
 #include <StepData_StepModel.hxx>
 #include <Standard_Version.hxx>
@@ -41,11 +42,26 @@ public:
     {
         codePage = cp;
     }
+    /// Parse the file and transfer its content to the document
     void read(Handle(TDocStd_Document) hDoc);
 
+    /** @name Import stages
+     * The stages can be run separately, e.g. to do other work in between. Each stage
+     * reports its progress through the sequencer and throws Base::AbortException if the
+     * user cancels it.
+     */
+    //@{
+    /// Read the STEP entities of the file into the reader's model
+    void parse();
+    /// Transfer the root shapes of the parsed model with their attributes to the document
+    void transfer(Handle(TDocStd_Document) hDoc);
+    //@}
+
 private:
     Base::FileInfo file;
     Resource_FormatType codePage {};
+    STEPCAFControl_Reader aReader;
+    bool parsed = false;
 };
 
 }  // namespace Import
@@ -23,14 +23,31 @@
 
 
 #include <boost/core/ignore_unused.hpp>
+#include <BRep_Tool.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <IMeshTools_Parameters.hxx>
+#include <Precision.hxx>
+#include <gp.hxx>
 #include <Standard_Version.hxx>
 #include <TColStd_IndexedDataMapOfStringString.hxx>
+#include <TDF_LabelSequence.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
 #include <Message_ProgressRange.hxx>
 #include <RWGltf_CafWriter.hxx>
+#include <XCAFDoc_DocumentTool.hxx>
+#include <XCAFDoc_ShapeTool.hxx>
+#if OCC_VERSION_HEX >= 0x070700
+#include <RWGltf_DracoParameters.hxx>
+#endif
 
 #include "WriterGltf.h"
+#include <App/Application.h>
+#include <Base/Console.h>
 #include <Base/Exception.h>
+#include <Base/Tools.h>
 #include <Mod/Part/App/encodeFilename.h>
+#include <Mod/Part/App/Tools.h>
 
 using namespace Import;
 
@@ -38,7 +55,82 @@ WriterGltf::WriterGltf(const Base::FileInfo& file)  // NOLINT
     : file {file}
 {}
 
+namespace
+{
+bool hasMissingTriangulation(const TopoDS_Shape& shape)
+{
+    for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+        TopLoc_Location loc;
+        if (BRep_Tool::Triangulation(TopoDS::Face(xp.Current()), loc).IsNull()) {
+            return true;
+        }
+    }
+    return false;
+}
+}  // namespace
+
+void WriterGltf::tessellate(Handle(TDocStd_Document) hDoc) const
+{
+    // The view providers already triangulated the shapes they display and the triangulation
+    // lives on the shared TShape, so it travels with the exported shape. Only mesh what has
+    // no triangulation yet (e.g. when running headless) using the same parameters as
+    // ViewProviderPartExt, and never touch an existing one.
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part"
+    );
+    double deviation = hGrp->GetFloat("MeshDeviation", 0.2);
+    double angularDeflection = hGrp->GetFloat("MeshAngularDeflection", 28.65);
+
+    Handle(XCAFDoc_ShapeTool) aShapeTool = XCAFDoc_DocumentTool::ShapeTool(hDoc->Main());
+    TDF_LabelSequence labels;
+    aShapeTool->GetShapes(labels);
+
+    int count = 0;
+    for (Standard_Integer i = 1; i <= labels.Length(); i++) {
+        // Instances share the prototype's TShape, so meshing each prototype once is enough.
+        // Assemblies only refer to their components, which are prototypes themselves.
+        if (!XCAFDoc_ShapeTool::IsSimpleShape(labels.Value(i))) {
+            continue;
+        }
+        TopoDS_Shape shape = aShapeTool->GetShape(labels.Value(i));
+        if (shape.IsNull() || !hasMissingTriangulation(shape)) {
+            continue;
+        }
+
+        Standard_Real deflection = Part::Tools::getDeflection(shape, deviation);
+        if (deflection < gp::Resolution()) {
+            deflection = Precision::Confusion();
+        }
+
+        IMeshTools_Parameters meshParams;
+        meshParams.Deflection = deflection;
+        meshParams.Relative = Standard_False;
+        meshParams.Angle = Base::toRadians(angularDeflection);
+        meshParams.InParallel = Standard_True;
+        meshParams.AllowQualityDecrease = Standard_True;
+        BRepMesh_IncrementalMesh(shape, meshParams);
+        ++count;
+    }
+
+    if (count > 0) {
+        Base::Console().log("glTF export: tessellated %d shape(s) without triangulation\n", count);
+    }
+}
+
 void WriterGltf::write(Handle(TDocStd_Document) hDoc) const  // NOLINT
+{
+    tessellate(hDoc);
+
+    if (!perform(hDoc, quantize)) {
+        // OCCT may be built without Draco, then the compressed export fails
+        if (!quantize || !perform(hDoc, false)) {
+            throw Base::FileException("Cannot save to file: ", file);
+        }
+        Base::Console().warning("glTF export: quantization failed, OCCT may lack Draco support\n");
+    }
+}
+
+bool WriterGltf::perform(Handle(TDocStd_Document) hDoc, bool compress) const
 {
     std::string utf8Name = file.filePath();
     std::string name8bit = Part::encodeFilename(utf8Name);
@@ -51,9 +143,20 @@ void WriterGltf::write(Handle(TDocStd_Document) hDoc) const  // NOLINT
     aWriter.ChangeCoordinateSystemConverter().SetInputCoordinateSystem(RWMesh_CoordinateSystem_Zup);
 #if OCC_VERSION_HEX >= 0x070700
     aWriter.SetParallel(true);
-#endif
-    Standard_Boolean ret = aWriter.Perform(hDoc, aMetadata, Message_ProgressRange());
-    if (!ret) {
-        throw Base::FileException("Cannot save to file: ", file);
+    // Faces of a part become one primitive, i.e. one mesh per unique shape. Shapes referenced
+    // several times in the XCAF document are written once and instanced by nodes.
+    aWriter.SetMergeFaces(mergeFaces);
+    if (compress) {
+        RWGltf_DracoParameters draco;
+        draco.DracoCompression = true;
+        draco.QuantizePositionBits = 14;  // NOLINT
+        draco.QuantizeNormalBits = 10;    // NOLINT
+        aWriter.SetCompressionParameters(draco);
+    }
+#else
+    if (mergeFaces || compress) {
+        Base::Console().warning("glTF export: merging faces and quantization need OCCT 7.7\n");
     }
+#endif
+    return aWriter.Perform(hDoc, aMetadata, Message_ProgressRange());
 }
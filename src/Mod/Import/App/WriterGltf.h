@@ -35,9 +35,26 @@ class ImportExport WriterGltf
 public:
     explicit WriterGltf(const Base::FileInfo& file);
 
+    /// Merge the faces of a part into a single primitive (OCC >= 7.7)
+    void setMergeFaces(bool on)
+    {
+        mergeFaces = on;
+    }
+    /// Quantize positions and normals via Draco compression (OCC >= 7.7)
+    void setQuantize(bool on)
+    {
+        quantize = on;
+    }
+
     void write(Handle(TDocStd_Document) hDoc) const;
 
+private:
+    void tessellate(Handle(TDocStd_Document) hDoc) const;
+    bool perform(Handle(TDocStd_Document) hDoc, bool compress) const;
+
 private:
     Base::FileInfo file;
+    bool mergeFaces = false;
+    bool quantize = false;
 };
 }  // namespace Import
@@ -277,6 +277,11 @@ private:
                             static_cast<bool>(Py::Boolean(options.getItem("reduceObjects")))
                         );
                     }
+                    if (options.hasKey("instanceLinks")) {
+                        ocaf.setInstanceLinks(
+                            static_cast<bool>(Py::Boolean(options.getItem("instanceLinks")))
+                        );
+                    }
                     if (options.hasKey("showProgress")) {
                         ocaf.setShowProgress(
                             static_cast<bool>(Py::Boolean(options.getItem("showProgress")))
@@ -526,9 +531,18 @@ private:
                                                          : Base::asBoolean(pykeepPlacement));
         // clang-format on
 
+        bool mergeFaces = false;
+        bool quantize = false;
+
         // new way
         if (pyoptions) {
             Py::Dict options(pyoptions);
+            if (options.hasKey("mergeFaces")) {
+                mergeFaces = static_cast<bool>(Py::Boolean(options.getItem("mergeFaces")));
+            }
+            if (options.hasKey("quantize")) {
+                quantize = static_cast<bool>(Py::Boolean(options.getItem("quantize")));
+            }
             if (options.hasKey("legacy")) {
                 legacyExport = static_cast<bool>(Py::Boolean(options.getItem("legacy")));
             }
@@ -589,6 +603,8 @@ private:
             }
             else if (file.hasExtension({"glb", "gltf"})) {
                 Import::WriterGltf writer(file);
+                writer.setMergeFaces(mergeFaces);
+                writer.setQuantize(quantize);
                 writer.write(hDoc);
             }
 
@@ -21,7 +21,9 @@
 #                                                                         *
 # **************************************************************************
 
+import json
 import os
+import struct
 import tempfile
 import unittest
 import FreeCAD as App
@@ -91,3 +93,61 @@ class ExportImportTest(unittest.TestCase):
 
         mat = paths.get(1).getTail()
         self.assertEqual(mat.diffuseColor.getNum(), 6)
+
+    def testImportInstanceLinks(self):
+        """
+        Import an assembly with many instances of one part as links to a single shape object
+        """
+        count = 1000
+        part = self.doc.addObject("App::Part", "Part")
+        box = self.doc.addObject("Part::Box", "Box")
+        for i in range(count):
+            link = part.newObject("App::Link", "Link")
+            link.LinkedObject = box
+            link.Placement.Base = App.Vector(2 * i, 0, 0)
+        self.doc.recompute()
+
+        ImportGui.export([part], self.fileName)
+
+        self.doc.clearDocument()
+        options = {
+            "merge": False,
+            "useLinkGroup": True,
+            "reduceObjects": False,
+            "instanceLinks": True,
+            "mode": 0,
+        }
+        ImportGui.insert(name=self.fileName, docName=self.doc.Name, options=options)
+
+        features = list(filter(lambda x: x.isDerivedFrom("Part::Feature"), self.doc.Objects))
+        links = list(filter(lambda x: x.isDerivedFrom("App::Link"), self.doc.Objects))
+        self.assertEqual(len(features), 1)
+        self.assertEqual(len(links), count)
+        self.assertTrue(all(link.LinkedObject == features[0] for link in links))
+
+    def testExportGlbSharedMeshes(self):
+        """
+        Export many links to one part as GLB and check the mesh is written only once
+        """
+        count = 100
+        part = self.doc.addObject("App::Part", "Part")
+        box = self.doc.addObject("Part::Box", "Box")
+        for i in range(count):
+            link = part.newObject("App::Link", "Link")
+            link.LinkedObject = box
+            link.Placement.Base = App.Vector(2 * i, 0, 0)
+        self.doc.recompute()
+
+        fileName = os.path.splitext(self.fileName)[0] + ".glb"
+        ImportGui.export([part], fileName, {"mergeFaces": True})
+
+        with open(fileName, "rb") as glb:
+            magic, _, _ = struct.unpack("<4sII", glb.read(12))
+            length, chunk = struct.unpack("<I4s", glb.read(8))
+            gltf = json.loads(glb.read(length))
+        os.remove(fileName)
+
+        self.assertEqual(magic, b"glTF")
+        self.assertEqual(chunk, b"JSON")
+        self.assertGreaterEqual(len(gltf["nodes"]), count)
+        self.assertEqual(len(gltf["meshes"]), 1)
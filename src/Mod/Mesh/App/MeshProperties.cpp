@@ -745,20 +745,27 @@ void PropertyMeshKernel::setValuePtr(MeshObject* mesh)
     // before calling hasSetValue()
     Base::Reference<MeshObject> tmp(_meshObject);
     aboutToSetValue();
-    _meshObject = mesh;
+    setMeshObject(mesh);
     hasSetValue();
 }
 
 void PropertyMeshKernel::setValue(const MeshObject& mesh)
 {
     aboutToSetValue();
-    *_meshObject = mesh;
+    if (meshShare.use_count() > 1) {
+        // the shared mesh object is replaced as a whole, there is no need to copy it first
+        setMeshObject(new MeshObject(mesh));
+    }
+    else {
+        *_meshObject = mesh;
+    }
     hasSetValue();
 }
 
 void PropertyMeshKernel::setValue(const MeshCore::MeshKernel& mesh)
 {
     aboutToSetValue();
+    detachMesh();
     _meshObject->setKernel(mesh);
     hasSetValue();
 }
@@ -766,6 +773,7 @@ void PropertyMeshKernel::setValue(const MeshCore::MeshKernel& mesh)
 void PropertyMeshKernel::swapMesh(MeshObject& mesh)
 {
     aboutToSetValue();
+    detachMesh();
     _meshObject->swap(mesh);
     hasSetValue();
 }
@@ -773,10 +781,28 @@ void PropertyMeshKernel::swapMesh(MeshObject& mesh)
 void PropertyMeshKernel::swapMesh(MeshCore::MeshKernel& mesh)
 {
     aboutToSetValue();
+    detachMesh();
     _meshObject->swap(mesh);
     hasSetValue();
 }
 
+void PropertyMeshKernel::setMeshObject(MeshObject* mesh, std::shared_ptr<int> share)
+{
+    _meshObject = mesh;
+    meshShare = std::move(share);
+    if (meshPyObject) {
+        // keep the Python wrapper on the mesh object of this property
+        meshPyObject->setTwinPointer(mesh);
+    }
+}
+
+void PropertyMeshKernel::detachMesh()
+{
+    if (meshShare.use_count() > 1) {
+        setMeshObject(new MeshObject(*_meshObject));
+    }
+}
+
 const MeshObject& PropertyMeshKernel::getValue() const
 {
     return *_meshObject;
@@ -808,6 +834,7 @@ unsigned int PropertyMeshKernel::getMemSize() const
 MeshObject* PropertyMeshKernel::startEditing()
 {
     aboutToSetValue();
+    detachMesh();
     return static_cast<MeshObject*>(_meshObject);
 }
 
@@ -819,6 +846,7 @@ void PropertyMeshKernel::finishEditing()
 void PropertyMeshKernel::transformGeometry(const Base::Matrix4D& rclMat)
 {
     aboutToSetValue();
+    detachMesh();
     _meshObject->transformGeometry(rclMat);
     hasSetValue();
 }
@@ -826,6 +854,7 @@ void PropertyMeshKernel::transformGeometry(const Base::Matrix4D& rclMat)
 void PropertyMeshKernel::setPointIndices(const std::vector<std::pair<PointIndex, Base::Vector3f>>& inds)
 {
     aboutToSetValue();
+    detachMesh();
     MeshCore::MeshKernel& kernel = _meshObject->getKernel();
     for (const auto& it : inds) {
         kernel.SetPoint(it.first, it.second);
@@ -835,6 +864,7 @@ void PropertyMeshKernel::setPointIndices(const std::vector<std::pair<PointIndex,
 
 void PropertyMeshKernel::setTransform(const Base::Matrix4D& rclTrf)
 {
+    detachMesh();
     _meshObject->setTransform(rclTrf);
 }
 
@@ -910,6 +940,7 @@ void PropertyMeshKernel::Restore(Base::XMLReader& reader)
         kernel.Adopt(points, facets);
 
         aboutToSetValue();
+        detachMesh();
         _meshObject->getKernel().Adopt(points, facets);
         hasSetValue();
     }
@@ -927,23 +958,26 @@ void PropertyMeshKernel::SaveDocFile(Base::Writer& writer) const
 void PropertyMeshKernel::RestoreDocFile(Base::Reader& reader)
 {
     aboutToSetValue();
+    detachMesh();
     _meshObject->load(reader);
     hasSetValue();
 }
 
 App::Property* PropertyMeshKernel::Copy() const
 {
-    // Note: Copy the content, do NOT reference the same mesh object
+    // Note: Reference the same mesh object, it gets copied by the first of the two properties
+    // that is modified. So a transaction does not copy a mesh that is not changed.
     PropertyMeshKernel* prop = new PropertyMeshKernel();
-    *(prop->_meshObject) = *(this->_meshObject);
+    prop->_meshObject = this->_meshObject;
+    prop->meshShare = this->meshShare;
     return prop;
 }
 
 void PropertyMeshKernel::Paste(const App::Property& from)
 {
-    // Note: Copy the content, do NOT reference the same mesh object
+    // Note: Reference the same mesh object, see Copy()
     aboutToSetValue();
     const PropertyMeshKernel& prop = dynamic_cast<const PropertyMeshKernel&>(from);
-    *(this->_meshObject) = *(prop._meshObject);
+    setMeshObject(prop._meshObject, prop.meshShare);
     hasSetValue();
 }
@@ -26,6 +26,7 @@
 
 #include <list>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
@@ -322,7 +323,17 @@ public:
     //@}
 
 private:
+    /// Replaces the referenced mesh object, also in the Python wrapper
+    void setMeshObject(MeshObject* mesh, std::shared_ptr<int> share = std::make_shared<int>());
+    /// Copies the mesh object before modifying it if it is shared with a copy of this property
+    void detachMesh();
+
+private:
+    // The mesh object may be shared with copies of this property, e.g. the ones kept by the
+    // undo/redo transactions, which then also share meshShare. The mesh object must be detached
+    // before modifying it. Other references to it, e.g. by the view provider, do not count.
     Base::Reference<MeshObject> _meshObject;
+    std::shared_ptr<int> meshShare {std::make_shared<int>()};
     MeshPy* meshPyObject {nullptr};
 };
 
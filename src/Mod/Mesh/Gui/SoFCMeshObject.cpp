@@ -24,18 +24,28 @@
 
 #include <FCConfig.h>
 
-#include <algorithm>
-#include <limits>
-#ifdef FC_OS_WIN32
+#ifndef FC_OS_WIN32
+# ifndef GL_GLEXT_PROTOTYPES
+#  define GL_GLEXT_PROTOTYPES 1
+# endif
+#else
 # include <windows.h>
 #endif
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
 #ifdef FC_OS_MACOSX
 # include <OpenGL/gl.h>
+# include <OpenGL/glext.h>
 # include <OpenGL/glu.h>
 #else
 # include <GL/gl.h>
+# include <GL/glext.h>
 # include <GL/glu.h>
 #endif
+#include <Inventor/SbBox3f.h>
 #include <Inventor/SbLine.h>
 #include <Inventor/SoPickedPoint.h>
 #include <Inventor/SoPrimitiveVertex.h>
@@ -44,15 +54,23 @@
 #include <Inventor/actions/SoGetPrimitiveCountAction.h>
 #include <Inventor/actions/SoGLRenderAction.h>
 #include <Inventor/actions/SoPickAction.h>
+#include <Inventor/actions/SoRayPickAction.h>
 #include <Inventor/actions/SoSearchAction.h>
 #include <Inventor/bundles/SoMaterialBundle.h>
 #include <Inventor/bundles/SoTextureCoordinateBundle.h>
 #include <Inventor/details/SoFaceDetail.h>
 #include <Inventor/details/SoLineDetail.h>
+#include <Inventor/details/SoPointDetail.h>
+#include <Inventor/elements/SoGLLazyElement.h>
+#include <Inventor/elements/SoPickStyleElement.h>
+#include <Inventor/errors/SoDebugError.h>
+#include <Inventor/misc/SoNotification.h>
 #include <Inventor/misc/SoState.h>
 
+#include <Base/BoundBoxTree.h>
 #include <Base/Console.h>
 #include <Base/Exception.h>
+#include <Gui/GLBuffer.h>
 #include <Gui/SoFCInteractiveElement.h>
 #include <Gui/Selection/SoFCSelectionAction.h>
 #include <Mod/Mesh/App/Core/Algorithm.h>
@@ -602,6 +620,192 @@ inline SbVec3f sbvec3f(const Base::Vector3f& _v)
     return {_v.x, _v.y, _v.z};
 }
 
+/**
+ * Keeps the facets of the mesh in buffer objects of the graphics card. Every facet has its own
+ * three corners with the flat normal, so that the facets can be drawn without an index buffer.
+ * The colors are kept in a buffer of their own, a change of the material like the highlighting
+ * of selected facets only uploads the colors again.
+ */
+class SoFCMeshObjectShape::VBO
+{
+public:
+    VBO()
+        : geometry(GL_ARRAY_BUFFER)
+        , colors(GL_ARRAY_BUFFER)
+    {}
+
+    static bool isSupported(SoGLRenderAction* action)
+    {
+        static bool init = false;
+        static bool vboAvailable = false;
+        if (!init) {
+            vboAvailable = Gui::OpenGLBuffer::isVBOSupported(action->getCacheContext());
+            if (!vboAvailable) {
+                SoDebugError::postInfo(
+                    "SoFCMeshObjectShape",
+                    "GL_ARB_vertex_buffer_object extension not supported"
+                );
+            }
+            init = true;
+        }
+        return vboAvailable;
+    }
+
+    void geometryChanged()
+    {
+        geometry.destroy();
+        colors.destroy();
+    }
+
+    void colorsChanged()
+    {
+        colors.destroy();
+    }
+
+    bool render(SoGLRenderAction* action, const Mesh::MeshObject* mesh, Binding bind, bool ccw)
+    {
+        uint32_t context = action->getCacheContext();
+        if (this->ccw != ccw || this->mesh != mesh) {
+            this->ccw = ccw;
+            this->mesh = mesh;
+            geometryChanged();
+        }
+
+        SoGLLazyElement* gl = SoGLLazyElement::getInstance(action->getState());
+        if (bind != OVERALL && !sameMaterial(gl, bind)) {
+            colorsChanged();
+        }
+
+        geometry.setCurrentContext(context);
+        if (!geometry.isCreated(context)) {
+            if (!geometry.create()) {
+                return false;
+            }
+            std::vector<float> vertex = createGeometry(mesh);
+            geometry.bind();
+            geometry.allocate(vertex.data(), static_cast<int>(vertex.size() * sizeof(float)));
+            geometry.release();
+            numVertices = static_cast<GLsizei>(vertex.size() / 6);
+        }
+
+        colors.setCurrentContext(context);
+        if (bind != OVERALL && !colors.isCreated(context)) {
+            if (!colors.create()) {
+                return false;
+            }
+            std::vector<uint32_t> rgba = createColors(mesh, gl, bind);
+            colors.bind();
+            colors.allocate(rgba.data(), static_cast<int>(rgba.size() * sizeof(uint32_t)));
+            colors.release();
+            colorBinding = bind;
+            colorPointer = gl ? gl->getDiffusePointer() : nullptr;
+            numColors = gl ? gl->getNumDiffuse() : 0;
+        }
+
+        geometry.bind();
+        glInterleavedArrays(GL_N3F_V3F, 0, nullptr);
+        if (bind != OVERALL) {
+            colors.bind();
+            glEnableClientState(GL_COLOR_ARRAY);
+            glColorPointer(4, GL_UNSIGNED_BYTE, 0, nullptr);
+        }
+
+        glDrawArrays(GL_TRIANGLES, 0, numVertices);
+
+        glDisableClientState(GL_COLOR_ARRAY);
+        glDisableClientState(GL_NORMAL_ARRAY);
+        glDisableClientState(GL_VERTEX_ARRAY);
+        geometry.release();
+        return true;
+    }
+
+private:
+    bool sameMaterial(SoGLLazyElement* gl, Binding bind) const
+    {
+        if (!gl) {
+            return colorPointer == nullptr;
+        }
+        return bind == colorBinding && gl->getDiffusePointer() == colorPointer
+            && gl->getNumDiffuse() == numColors;
+    }
+
+    // The normal and position of the three corners of every facet
+    std::vector<float> createGeometry(const Mesh::MeshObject* mesh) const
+    {
+        const MeshCore::MeshKernel& kernel = mesh->getKernel();
+        const MeshCore::MeshPointArray& rPoints = kernel.GetPoints();
+        const MeshCore::MeshFacetArray& rFacets = kernel.GetFacets();
+
+        std::vector<float> vertex;
+        vertex.reserve(rFacets.size() * 3 * 6);
+        for (const auto& facet : rFacets) {
+            Base::Vector3f n = kernel.GetFacet(facet).GetNormal();
+            if (!ccw) {
+                n = -n;
+            }
+            for (Mesh::PointIndex ptIndex : facet._aulPoints) {
+                const Base::Vector3f& v = rPoints[ptIndex];
+                vertex.insert(vertex.end(), {n.x, n.y, n.z, v.x, v.y, v.z});
+            }
+        }
+        return vertex;
+    }
+
+    // The color of the three corners of every facet as RGBA bytes
+    static std::vector<uint32_t> createColors(
+        const Mesh::MeshObject* mesh,
+        SoGLLazyElement* gl,
+        Binding bind
+    )
+    {
+        const MeshCore::MeshFacetArray& rFacets = mesh->getKernel().GetFacets();
+        std::vector<uint32_t> rgba(rFacets.size() * 3, 0xffffffff);
+        int numcolors = gl ? gl->getNumDiffuse() : 0;
+        if (numcolors == 0) {
+            return rgba;
+        }
+
+        const SbColor* pcolors = gl->getDiffusePointer();
+        const float* transp = gl->getTransparencyPointer();
+        float alpha = transp && gl->getNumTransparencies() > 0 ? 1.0F - transp[0] : 1.0F;
+        auto toByte = [](float value) {
+            return static_cast<uint8_t>(std::clamp(value, 0.0F, 1.0F) * 255.0F + 0.5F);
+        };
+        auto pack = [&](std::size_t index) {
+            const SbColor& c = pcolors[std::min<std::size_t>(index, numcolors - 1)];
+            std::array<uint8_t, 4> bytes {toByte(c[0]), toByte(c[1]), toByte(c[2]), toByte(alpha)};
+            uint32_t value {};
+            std::memcpy(&value, bytes.data(), sizeof(value));
+            return value;
+        };
+
+        auto it = rgba.begin();
+        for (std::size_t index = 0; index < rFacets.size(); ++index) {
+            if (bind == PER_FACE_INDEXED) {
+                std::fill_n(it, 3, pack(index));
+                it += 3;
+            }
+            else {
+                for (Mesh::PointIndex ptIndex : rFacets[index]._aulPoints) {
+                    *it++ = pack(ptIndex);
+                }
+            }
+        }
+        return rgba;
+    }
+
+    Gui::OpenGLMultiBuffer geometry;
+    Gui::OpenGLMultiBuffer colors;
+    GLsizei numVertices {0};
+    // the mesh and vertex ordering the geometry buffer is made of
+    const Mesh::MeshObject* mesh {nullptr};
+    bool ccw {true};
+    // the material the color buffer is made of
+    Binding colorBinding {OVERALL};
+    const SbColor* colorPointer {nullptr};
+    int numColors {0};
+};
+
 SO_NODE_SOURCE(SoFCMeshObjectShape)
 
 void SoFCMeshObjectShape::initClass()
@@ -611,8 +815,11 @@ void SoFCMeshObjectShape::initClass()
 
 SoFCMeshObjectShape::SoFCMeshObjectShape()
     : renderTriangleLimit(std::numeric_limits<unsigned>::max())
+    , vbo(std::make_unique<VBO>())
 {
     SO_NODE_CONSTRUCTOR(SoFCMeshObjectShape);
+    SO_NODE_ADD_FIELD(updateColors, (false));
+    updateColors.setFieldType(SoField::EVENTOUT_FIELD);
     setName(SoFCMeshObjectShape::getClassTypeId().getName());
 }
 
@@ -621,7 +828,14 @@ SoFCMeshObjectShape::~SoFCMeshObjectShape() = default;
 void SoFCMeshObjectShape::notify(SoNotList* node)
 {
     inherited::notify(node);
+    // a change of the material only needs new colors
+    if (node->getLastField() == &updateColors) {
+        vbo->colorsChanged();
+        return;
+    }
     updateGLArray = true;
+    vbo->geometryChanged();
+    pickTree.reset();
 }
 
 #define RENDER_GLARRAYS
@@ -658,7 +872,16 @@ void SoFCMeshObjectShape::GLRender(SoGLRenderAction* action)
             ccw = false;
         }
 
+        // get the VBO status of the viewer
+        SbBool useVBO = VBO::isSupported(action);
+        if (useVBO) {
+            Gui::SoGLVBOActivatedElement::get(state, useVBO);
+        }
+
         if (!mode || mesh->countFacets() <= this->renderTriangleLimit) {
+            if (useVBO && vbo->render(action, mesh, mbind, ccw)) {
+                return;
+            }
             if (mbind != OVERALL) {
                 drawFaces(mesh, &mb, mbind, needNormals, ccw);
             }
@@ -1076,11 +1299,101 @@ void SoFCMeshObjectShape::renderSelectionGeometry(const Mesh::MeshObject* mesh)
 
 
 /**
- * Calculates picked point based on primitives generated by subclasses.
+ * Calculates the picked points of the facets hit by the ray. Only the facets whose bounding box
+ * is cut by the ray are tested, they are looked up in a tree of the facet boxes that is built
+ * on the first pick after the mesh has changed.
  */
 void SoFCMeshObjectShape::rayPick(SoRayPickAction* action)
 {
-    inherited::rayPick(action);
+    SoState* state = action->getState();
+    const Mesh::MeshObject* mesh = SoFCMeshObjectElement::get(state);
+    SoPickStyleElement::Style style = SoPickStyleElement::get(state);
+    bool pickShape = style == SoPickStyleElement::SHAPE
+        || style == SoPickStyleElement::SHAPE_ON_TOP;
+    if (!mesh || !pickShape) {
+        inherited::rayPick(action);
+        return;
+    }
+    if (!shouldRayPick(action)) {
+        return;
+    }
+
+    action->setObjectSpace();
+
+    const MeshCore::MeshPointArray& rPoints = mesh->getKernel().GetPoints();
+    const MeshCore::MeshFacetArray& rFacets = mesh->getKernel().GetFacets();
+    Binding mbind = this->findMaterialBinding(state);
+
+    auto testBox = [action](const Base::BoundBox3f& box) {
+        SbBox3f bbox(box.MinX, box.MinY, box.MinZ, box.MaxX, box.MaxY, box.MaxZ);
+        return action->intersect(bbox);
+    };
+    auto testFacet = [&](std::size_t index) {
+        const MeshCore::MeshFacet& rFacet = rFacets[index];
+        SbVec3f v0 = sbvec3f(rPoints[rFacet._aulPoints[0]]);
+        SbVec3f v1 = sbvec3f(rPoints[rFacet._aulPoints[1]]);
+        SbVec3f v2 = sbvec3f(rPoints[rFacet._aulPoints[2]]);
+        SbVec3f point;
+        SbVec3f barycentric;
+        SbBool front {};
+        if (!action->intersect(v0, v1, v2, point, barycentric, front)
+            || !action->isBetweenPlanes(point)) {
+            return true;
+        }
+
+        SoPickedPoint* pp = action->addIntersection(point);
+        if (!pp) {
+            return true;
+        }
+
+        SbVec3f normal = (v1 - v0).cross(v2 - v0);
+        normal.normalize();
+        pp->setObjectNormal(normal);
+
+        // Same details as generatePrimitives() creates
+        auto detail = new SoFaceDetail();
+        detail->setFaceIndex(static_cast<int>(index));
+        detail->setNumPoints(3);
+        SoPointDetail pointDetail;
+        for (int i = 0; i < 3; i++) {
+            auto pointIndex = static_cast<int>(rFacet._aulPoints[i]);
+            if (mbind == PER_VERTEX_INDEXED || mbind == PER_FACE_INDEXED) {
+                pointDetail.setMaterialIndex(pointIndex);
+            }
+            pointDetail.setCoordinateIndex(pointIndex);
+            detail->setPoint(i, &pointDetail);
+        }
+        if (mbind == PER_VERTEX_INDEXED || mbind == PER_FACE_INDEXED) {
+            pp->setMaterialIndex(static_cast<int>(rFacet._aulPoints[0]));
+        }
+        pp->setDetail(detail, this);
+        return true;
+    };
+
+    getPickTree(mesh).traverse(testBox, testFacet);
+}
+
+const Base::BoundBoxTree& SoFCMeshObjectShape::getPickTree(const Mesh::MeshObject* mesh)
+{
+    if (pickTree && pickMesh == mesh) {
+        return *pickTree;
+    }
+
+    const MeshCore::MeshPointArray& rPoints = mesh->getKernel().GetPoints();
+    const MeshCore::MeshFacetArray& rFacets = mesh->getKernel().GetFacets();
+    std::vector<Base::BoundBox3f> boxes;
+    boxes.reserve(rFacets.size());
+    for (const auto& rFacet : rFacets) {
+        Base::BoundBox3f box;
+        box.Add(rPoints[rFacet._aulPoints[0]]);
+        box.Add(rPoints[rFacet._aulPoints[1]]);
+        box.Add(rPoints[rFacet._aulPoints[2]]);
+        boxes.push_back(box);
+    }
+
+    pickTree = std::make_unique<Base::BoundBoxTree>(boxes);
+    pickMesh = mesh;
+    return *pickTree;
 }
 
 /** Sets the point indices, the geometric points and the normal for each triangle.
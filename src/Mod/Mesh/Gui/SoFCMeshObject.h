@@ -24,7 +24,10 @@
 
 #pragma once
 
+#include <memory>
+
 #include <Inventor/elements/SoReplacedElement.h>
+#include <Inventor/fields/SoSFBool.h>
 #include <Inventor/fields/SoSFUInt32.h>
 #include <Inventor/fields/SoSFVec3f.h>
 #include <Inventor/fields/SoSFVec3s.h>
@@ -37,6 +40,11 @@ using GLuint = unsigned int;
 using GLint = int;
 using GLfloat = float;
 
+namespace Base
+{
+class BoundBoxTree;
+}
+
 namespace MeshCore
 {
 class MeshFacetGrid;
@@ -188,6 +196,8 @@ public:
     SoFCMeshObjectShape();
 
     unsigned int renderTriangleLimit;  // NOLINT
+    /// Connected to a SoFCMaterialEngine to update only the colors of the buffer objects
+    SoSFBool updateColors;  // NOLINT
 
 protected:
     void doAction(SoAction* action) override;
@@ -228,6 +238,7 @@ private:
     ) const;
     void drawPoints(const Mesh::MeshObject*, SbBool needNormals, SbBool ccw) const;
     unsigned int countTriangles(SoAction* action) const;
+    const Base::BoundBoxTree& getPickTree(const Mesh::MeshObject*);
 
     void startSelection(SoAction* action, const Mesh::MeshObject*);
     void stopSelection(SoAction* action, const Mesh::MeshObject*);
@@ -237,6 +248,8 @@ private:
     void renderFacesGLArray(SoGLRenderAction* action);
     void renderCoordsGLArray(SoGLRenderAction* action);
 
+    class VBO;
+
 private:
     GLuint* selectBuf {nullptr};
     GLfloat modelview[16] {};
@@ -245,6 +258,11 @@ private:
     std::vector<int32_t> index_array;
     std::vector<float> vertex_array;
     SbBool updateGLArray {false};
+    // Buffer objects of the facets, built once per geometry change
+    std::unique_ptr<VBO> vbo;
+    // Facet boxes for picking, built on demand
+    std::unique_ptr<Base::BoundBoxTree> pickTree;
+    const Mesh::MeshObject* pickMesh {nullptr};
 };
 
 class MeshGuiExport SoFCMeshSegmentShape: public SoShape
@@ -2611,6 +2611,11 @@ void ViewProviderMeshObject::attach(App::DocumentObject* obj)
     pcMeshShape = new SoFCMeshObjectShape;
     pcHighlight->addChild(pcMeshShape);
 
+    // setup engine to notify 'pcMeshShape' node about material changes
+    SoFCMaterialEngine* engine = new SoFCMaterialEngine();
+    engine->diffuseColor.connectFrom(&pcShapeMaterial->diffuseColor);
+    pcMeshShape->updateColors.connectFrom(&engine->trigger);
+
     // read the threshold from the preferences
     Base::Reference<ParameterGrp> hGrp = Gui::WindowParameter::getDefaultParameter()->GetGroup(
         "Mod/Mesh"
@@ -62,11 +62,12 @@ ViewProviderMeshFaceSet::ViewProviderMeshFaceSet()
     pcMeshFaces = new SoFCIndexedFaceSet;
     pcMeshFaces->ref();
 
-    // setup engine to notify 'pcMeshFaces' node about material changes.
+    // setup engine to notify 'pcMeshFaces' and 'pcMeshShape' nodes about material changes.
     // When the affected nodes are deleted the engine will be deleted, too.
     SoFCMaterialEngine* engine = new SoFCMaterialEngine();
     engine->diffuseColor.connectFrom(&pcShapeMaterial->diffuseColor);
     pcMeshFaces->updateGLArray.connectFrom(&engine->trigger);
+    pcMeshShape->updateColors.connectFrom(&engine->trigger);
     // NOLINTEND
 }
 
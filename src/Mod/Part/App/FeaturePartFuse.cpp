@@ -22,19 +22,28 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+
 #include <Mod/Part/App/FCBRepAlgoAPI_Fuse.h>
 #include <BRepCheck_Analyzer.hxx>
+#include <OSD_Parallel.hxx>
 #include <Standard_Failure.hxx>
 #include <TopoDS_Iterator.hxx>
 #include <TopExp.hxx>
 #include <TopTools_IndexedMapOfShape.hxx>
+#include <TopTools_ListIteratorOfListOfShape.hxx>
 
 
 #include "FeaturePartFuse.h"
 #include "TopoShape.h"
+#include "TopoShapeMapper.h"
 #include "modelRefine.h"
 #include "TopoShapeOpCode.h"
 
+#include <Base/TimeInfo.h>
+
 FC_LOG_LEVEL_INIT("Part", true, true);
 
 using namespace Part;
@@ -65,6 +74,8 @@ const char* Fuse::opCode() const
 
 PROPERTY_SOURCE(Part::MultiFuse, Part::Feature)
 
+const char* MultiFuse::ModeEnums[] = {"Standard", "TreeReduction", nullptr};
+
 
 MultiFuse::MultiFuse()
 {
@@ -88,6 +99,17 @@ MultiFuse::MultiFuse()
     );
 
     this->Refine.setValue(getRefineModelParameter());
+
+    ADD_PROPERTY_TYPE(
+        Mode,
+        (static_cast<long>(MultiFuseMode::Standard)),
+        "Boolean",
+        (App::PropertyType)(App::Prop_None),
+        "Standard: fuse all shapes in a single boolean operation.\n"
+        "TreeReduction: group the shapes by their bounding boxes and fuse\n"
+        "neighbouring pairs in parallel, level by level"
+    );
+    Mode.setEnums(ModeEnums);
 }
 
 short MultiFuse::mustExecute() const
@@ -95,9 +117,289 @@ short MultiFuse::mustExecute() const
     if (Shapes.isTouched()) {
         return 1;
     }
+    if (Mode.isTouched()) {
+        return 1;
+    }
     return 0;
 }
 
+namespace
+{
+
+/// Reorder the given shape indices so that spatially close shapes become neighbours.
+/// The set is split recursively at the median of the bounding box centers along the
+/// axis of largest extent, which yields a balanced kd-tree ordering.
+void sortSpatially(
+    std::vector<int>::iterator begin,
+    std::vector<int>::iterator end,
+    const std::vector<Base::Vector3d>& centers
+)
+{
+    if (std::distance(begin, end) <= 2) {
+        return;
+    }
+
+    Base::BoundBox3d bounds;
+    for (auto it = begin; it != end; ++it) {
+        bounds.Add(centers[*it]);
+    }
+
+    int axis = 0;
+    if (bounds.LengthY() > bounds.LengthX() && bounds.LengthY() >= bounds.LengthZ()) {
+        axis = 1;
+    }
+    else if (bounds.LengthZ() > bounds.LengthX() && bounds.LengthZ() > bounds.LengthY()) {
+        axis = 2;
+    }
+
+    auto mid = begin + std::distance(begin, end) / 2;
+    std::nth_element(begin, mid, end, [&centers, axis](int a, int b) {
+        return centers[a][axis] < centers[b][axis];
+    });
+    sortSpatially(begin, mid, centers);
+    sortSpatially(mid, end, centers);
+}
+
+/// Maps the sub-shapes of the operands to the result of the fusion tree. Every sub-shape is
+/// followed through the fusions its operand took part in, so that the result gets the same
+/// element names as a single fusion of all operands.
+struct TreeFuseMapper: TopoShape::Mapper
+{
+    explicit TreeFuseMapper(const std::vector<TopoShape>& shapes)
+        : steps(shapes.size())
+    {
+        for (std::size_t i = 0; i < shapes.size(); ++i) {
+            TopTools_IndexedMapOfShape map;
+            TopExp::MapShapes(shapes[i].getShape(), map);
+            for (int j = 1; j <= map.Extent(); ++j) {
+                operands.emplace(map(j), static_cast<int>(i));
+            }
+        }
+    }
+
+    const std::vector<TopoDS_Shape>& modified(const TopoDS_Shape& s) const override
+    {
+        _res.clear();
+        auto it = operands.find(s);
+        if (it == operands.end()) {
+            return _res;
+        }
+        const auto& fusions = steps[it->second];
+        try {
+            std::vector<TopoDS_Shape> current {s};
+            follow(current, fusions, 0, fusions.size());
+            // an unchanged shape is found by the element map itself
+            if (current.size() != 1 || !current.front().IsSame(s)) {
+                _res = std::move(current);
+            }
+        }
+        catch (Standard_Failure&) {
+            _res.clear();
+        }
+        return _res;
+    }
+
+    const std::vector<TopoDS_Shape>& generated(const TopoDS_Shape& s) const override
+    {
+        _res.clear();
+        auto it = operands.find(s);
+        if (it == operands.end()) {
+            return _res;
+        }
+        const auto& fusions = steps[it->second];
+        try {
+            std::vector<TopoDS_Shape> current {s};
+            for (std::size_t k = 0; k < fusions.size() && !current.empty(); ++k) {
+                for (const auto& shape : current) {
+                    TopTools_ListIteratorOfListOfShape jt;
+                    for (jt.Initialize(fusions[k]->Generated(shape)); jt.More(); jt.Next()) {
+                        std::vector<TopoDS_Shape> result {jt.Value()};
+                        follow(result, fusions, k + 1, fusions.size());
+                        _res.insert(_res.end(), result.begin(), result.end());
+                    }
+                }
+                follow(current, fusions, k, k + 1);
+            }
+        }
+        catch (Standard_Failure&) {
+            _res.clear();
+        }
+        return _res;
+    }
+
+    /// Replaces \a current with what the fusions from \a first to \a last made of it
+    static void follow(
+        std::vector<TopoDS_Shape>& current,
+        const std::vector<FCBRepAlgoAPI_Fuse*>& fusions,
+        std::size_t first,
+        std::size_t last
+    )
+    {
+        for (std::size_t k = first; k < last && !current.empty(); ++k) {
+            std::vector<TopoDS_Shape> next;
+            for (const auto& shape : current) {
+                const TopTools_ListOfShape& modified = fusions[k]->Modified(shape);
+                if (!modified.IsEmpty()) {
+                    TopTools_ListIteratorOfListOfShape it;
+                    for (it.Initialize(modified); it.More(); it.Next()) {
+                        next.push_back(it.Value());
+                    }
+                }
+                else if (!fusions[k]->IsDeleted(shape)) {
+                    next.push_back(shape);
+                }
+            }
+            current = std::move(next);
+        }
+    }
+
+    std::vector<std::unique_ptr<FCBRepAlgoAPI_Fuse>> makers;
+    // the fusions every operand took part in, from the leaves to the root
+    std::vector<std::vector<FCBRepAlgoAPI_Fuse*>> steps;
+    // the operand every sub-shape belongs to
+    std::unordered_map<TopoDS_Shape, int, ShapeHasher, ShapeHasher> operands;
+};
+
+}  // namespace
+
+TopoShape MultiFuse::fuseSingle(const std::vector<TopoShape>& shapes, std::vector<ShapeHistory>& history)
+{
+    FCBRepAlgoAPI_Fuse mkFuse;
+    TopTools_ListOfShape shapeArguments, shapeTools;
+    const TopoShape& shape = shapes.front();
+    if (shape.isNull()) {
+        throw Base::RuntimeError("Input shape is null");
+    }
+    shapeArguments.Append(shape.getShape());
+
+    for (auto it = shapes.begin() + 1; it != shapes.end(); ++it) {
+        if (it->isNull()) {
+            throw Base::RuntimeError("Input shape is null");
+        }
+        shapeTools.Append(it->getShape());
+    }
+
+    mkFuse.SetArguments(shapeArguments);
+    mkFuse.SetTools(shapeTools);
+    mkFuse.setAutoFuzzy();
+    mkFuse.Build();
+
+    if (!mkFuse.IsDone()) {
+        throw Base::RuntimeError("MultiFusion failed");
+    }
+
+    TopoShape res(0);
+    res = res.makeShapeWithElementMap(mkFuse.Shape(), MapperMaker(mkFuse), shapes, OpCodes::Fuse);
+    for (const auto& it : shapes) {
+        history.push_back(buildHistory(mkFuse, TopAbs_FACE, res.getShape(), it.getShape()));
+    }
+    return res;
+}
+
+TopoShape MultiFuse::fuseTree(const std::vector<TopoShape>& shapes, std::vector<ShapeHistory>& history)
+{
+    struct Node
+    {
+        TopoDS_Shape shape;
+        std::vector<int> operands;
+    };
+
+    std::vector<Base::Vector3d> centers;
+    centers.reserve(shapes.size());
+    for (const auto& shape : shapes) {
+        if (shape.isNull()) {
+            throw Base::RuntimeError("Input shape is null");
+        }
+        centers.push_back(shape.getBoundBox().GetCenter());
+    }
+
+    std::vector<int> order(shapes.size());
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        order[i] = static_cast<int>(i);
+    }
+    sortSpatially(order.begin(), order.end(), centers);
+
+    std::vector<Node> nodes;
+    nodes.reserve(order.size());
+    for (int index : order) {
+        nodes.push_back({shapes[index].getShape(), {index}});
+    }
+
+    // The makers are kept until the element map of the result is built from all of them
+    TreeFuseMapper mapper(shapes);
+
+    // History of every operand relative to the node it currently belongs to. It stays
+    // empty until the operand takes part in its first fusion.
+    history.assign(shapes.size(), ShapeHistory());
+    std::vector<bool> hasHistory(shapes.size(), false);
+
+    while (nodes.size() > 1) {
+        const int pairs = static_cast<int>(nodes.size() / 2);
+        std::vector<std::unique_ptr<FCBRepAlgoAPI_Fuse>> makers(pairs);
+
+        // The boolean operations of one level are independent of each other. The inputs are
+        // shared read-only, FCBRepAlgoAPI_BooleanOperation runs in non-destructive mode.
+        OSD_Parallel::For(0, pairs, [&nodes, &makers](int i) {
+            auto mk = std::make_unique<FCBRepAlgoAPI_Fuse>();
+            try {
+                TopTools_ListOfShape shapeArguments, shapeTools;
+                shapeArguments.Append(nodes[2 * i].shape);
+                shapeTools.Append(nodes[2 * i + 1].shape);
+                mk->SetArguments(shapeArguments);
+                mk->SetTools(shapeTools);
+                mk->setAutoFuzzy();
+                mk->Build();
+                makers[i] = std::move(mk);
+            }
+            catch (Standard_Failure&) {
+                // reported below together with the failing operands
+            }
+        });
+
+        std::vector<Node> next;
+        next.reserve(pairs + 1);
+        for (int i = 0; i < pairs; ++i) {
+            Node& first = nodes[2 * i];
+            Node& second = nodes[2 * i + 1];
+            FCBRepAlgoAPI_Fuse* mk = makers[i].get();
+            if (!mk || !mk->IsDone()) {
+                std::stringstream str;
+                str << "MultiFusion failed on operands";
+                for (int index : first.operands) {
+                    str << " " << index;
+                }
+                str << " and";
+                for (int index : second.operands) {
+                    str << " " << index;
+                }
+                throw Base::RuntimeError(str.str());
+            }
+
+            Node node;
+            node.shape = mk->Shape();
+            for (const Node* child : {&first, &second}) {
+                ShapeHistory hist = buildHistory(*mk, TopAbs_FACE, node.shape, child->shape);
+                for (int index : child->operands) {
+                    history[index] = hasHistory[index] ? joinHistory(history[index], hist) : hist;
+                    hasHistory[index] = true;
+                    mapper.steps[index].push_back(mk);
+                    node.operands.push_back(index);
+                }
+            }
+            next.push_back(std::move(node));
+            mapper.makers.push_back(std::move(makers[i]));
+        }
+        if (nodes.size() % 2 != 0) {
+            next.push_back(std::move(nodes.back()));
+        }
+        nodes = std::move(next);
+    }
+
+    TopoShape res(0);
+    res = res.makeShapeWithElementMap(nodes.front().shape, mapper, shapes, OpCodes::Fuse);
+    return res;
+}
+
 App::DocumentObjectExecReturn* MultiFuse::execute()
 {
     std::vector<TopoShape> shapes;
@@ -130,35 +432,23 @@ App::DocumentObjectExecReturn* MultiFuse::execute()
     if (shapes.size() >= 2) {
         try {
             std::vector<ShapeHistory> history;
-            FCBRepAlgoAPI_Fuse mkFuse;
-            TopTools_ListOfShape shapeArguments, shapeTools;
-            const TopoShape& shape = shapes.front();
-            if (shape.isNull()) {
-                throw Base::RuntimeError("Input shape is null");
-            }
-            shapeArguments.Append(shape.getShape());
+            Base::TimeElapsed startTime;
 
-            for (auto it2 = shapes.begin() + 1; it2 != shapes.end(); ++it2) {
-                if (it2->isNull()) {
-                    throw Base::RuntimeError("Input shape is null");
-                }
-                shapeTools.Append(it2->getShape());
+            TopoShape res;
+            if (Mode.getValue() == static_cast<long>(MultiFuseMode::TreeReduction)
+                && shapes.size() > 2) {
+                res = fuseTree(shapes, history);
             }
-
-            mkFuse.SetArguments(shapeArguments);
-            mkFuse.SetTools(shapeTools);
-            mkFuse.setAutoFuzzy();
-            mkFuse.Build();
-
-            if (!mkFuse.IsDone()) {
-                throw Base::RuntimeError("MultiFusion failed");
+            else {
+                res = fuseSingle(shapes, history);
             }
 
-            TopoShape res(0);
-            res = res.makeShapeWithElementMap(mkFuse.Shape(), MapperMaker(mkFuse), shapes, OpCodes::Fuse);
-            for (const auto& it2 : shapes) {
-                history.push_back(buildHistory(mkFuse, TopAbs_FACE, res.getShape(), it2.getShape()));
-            }
+            FC_LOG(
+                getFullName() << " fused " << shapes.size() << " shapes ("
+                              << Mode.getValueAsString() << ") in "
+                              << Base::TimeElapsed::diffTimeF(startTime, Base::TimeElapsed()) << "s"
+            );
+
             if (res.isNull()) {
                 throw Base::RuntimeError("Resulting shape is null");
             }
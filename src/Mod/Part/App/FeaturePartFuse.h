@@ -48,6 +48,13 @@ protected:
     //@}
 };
 
+/// The values of MultiFuse::Mode
+enum class MultiFuseMode
+{
+    Standard,
+    TreeReduction
+};
+
 class PartExport MultiFuse: public Part::Feature
 {
     PROPERTY_HEADER_WITH_OVERRIDE(Part::MultiFuse);
@@ -58,6 +65,7 @@ public:
     App::PropertyLinkList Shapes;
     PropertyShapeHistory History;
     App::PropertyBool Refine;
+    App::PropertyEnumeration Mode;
 
     /** @name methods override feature */
     //@{
@@ -70,6 +78,14 @@ public:
     {
         return "PartGui::ViewProviderMultiFuse";
     }
+
+private:
+    /// Fuse all shapes with one boolean operation
+    TopoShape fuseSingle(const std::vector<TopoShape>& shapes, std::vector<ShapeHistory>& history);
+    /// Fuse spatially sorted pairs of shapes in parallel and reduce the results in a balanced tree
+    TopoShape fuseTree(const std::vector<TopoShape>& shapes, std::vector<ShapeHistory>& history);
+
+    static const char* ModeEnums[];
 };
 
 }  // namespace Part
@@ -45,6 +45,7 @@
 
 #include <App/Document.h>
 #include <Base/Console.h>
+#include <Base/Sequencer.h>
 
 #include "ImportStep.h"
 #include "encodeFilename.h"
@@ -86,9 +87,11 @@ int Part::ImportStepParts(App::Document* pcDoc, const char* Name)
 
     // Root transfers
     Standard_Integer nbr = aReader.NbRootsForTransfer();
+    Base::SequencerLauncher seq("Transferring STEP roots...", nbr);
     for (Standard_Integer n = 1; n <= nbr; n++) {
         Base::Console().log("STEP: Transferring Root %d\n", n);
         aReader.TransferRoot(n);
+        seq.next(true);
     }
 
     // Collecting resulting entities
@@ -262,6 +262,16 @@ bool ImportExportSettings::getReduceObjects() const
     return pGroup->GetBool("ReduceObjects", false);
 }
 
+void ImportExportSettings::setInstanceLinks(bool on)
+{
+    pGroup->SetBool("InstanceLinks", on);
+}
+
+bool ImportExportSettings::getInstanceLinks() const
+{
+    return pGroup->GetBool("InstanceLinks", false);
+}
+
 void ImportExportSettings::setExpandCompound(bool on)
 {
     pGroup->SetBool("ExpandCompound", on);
@@ -97,6 +97,9 @@ public:
     void setReduceObjects(bool);
     bool getReduceObjects() const;
 
+    void setInstanceLinks(bool);
+    bool getInstanceLinks() const;
+
     void setExpandCompound(bool);
     bool getExpandCompound() const;
 
@@ -24,6 +24,7 @@
 
 
 #include <algorithm>
+#include <atomic>
 #include <numbers>
 #include <iterator>
 #include <Bnd_Box.hxx>
@@ -49,6 +50,7 @@
 #include <gp_Cylinder.hxx>
 #include <gp_Pln.hxx>
 #include <GProp_GProps.hxx>
+#include <OSD_Parallel.hxx>
 #include <ShapeAnalysis_Curve.hxx>
 #include <ShapeAnalysis_Shell.hxx>
 #include <ShapeBuild_ReShape.hxx>
@@ -64,12 +66,14 @@
 #include <TopExp_Explorer.hxx>
 #include <TopTools_DataMapIteratorOfDataMapOfIntegerListOfShape.hxx>
 #include <TopTools_DataMapIteratorOfDataMapOfShapeShape.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 #include <TopTools_ListIteratorOfListOfShape.hxx>
 #include <TopTools_ListOfShape.hxx>
 
 #include <Base/Console.h>
 
 #include "modelRefine.h"
+#include "TopoShape.h"
 
 
 using namespace ModelRefine;
@@ -86,30 +90,28 @@ void ModelRefine::getFaceEdges(const TopoDS_Face& face, EdgeVectorType& edges)
 void ModelRefine::boundaryEdges(const FaceVectorType& faces, EdgeVectorType& edgesOut)
 {
     // this finds all the boundary edges. Maybe more than one boundary.
-    std::list<TopoDS_Edge> edges;
-    FaceVectorType::const_iterator faceIt;
-    for (faceIt = faces.begin(); faceIt != faces.end(); ++faceIt) {
-        EdgeVectorType faceEdges;
-        EdgeVectorType::iterator faceEdgesIt;
-        getFaceEdges(*faceIt, faceEdges);
-        for (faceEdgesIt = faceEdges.begin(); faceEdgesIt != faceEdges.end(); ++faceEdgesIt) {
-            bool foundSignal(false);
-            std::list<TopoDS_Edge>::iterator edgesIt;
-            for (edgesIt = edges.begin(); edgesIt != edges.end(); ++edgesIt) {
-                if ((*edgesIt).IsSame(*faceEdgesIt)) {
-                    edgesIt = edges.erase(edgesIt);
-                    foundSignal = true;
-                    break;
-                }
-            }
-            if (!foundSignal) {
-                edges.push_back(*faceEdgesIt);
+    // An edge shared by two faces of the group is an inner edge, so only edges used an odd
+    // number of times are kept, in the order they were first seen.
+    TopTools_IndexedMapOfShape edgeMap;
+    std::vector<int> useCount;
+    EdgeVectorType faceEdges;
+    for (const auto& face : faces) {
+        faceEdges.clear();
+        getFaceEdges(face, faceEdges);
+        for (const auto& edge : faceEdges) {
+            int index = edgeMap.Add(edge);
+            if (index > static_cast<int>(useCount.size())) {
+                useCount.push_back(0);
             }
+            ++useCount[index - 1];
         }
     }
 
-    edgesOut.reserve(edges.size());
-    std::copy(edges.begin(), edges.end(), back_inserter(edgesOut));
+    for (int index = 1; index <= edgeMap.Extent(); ++index) {
+        if (useCount[index - 1] % 2 != 0) {
+            edgesOut.push_back(TopoDS::Edge(edgeMap(index)));
+        }
+    }
 }
 
 TopoDS_Shell ModelRefine::removeFaces(const TopoDS_Shell& shell, const FaceVectorType& faces)
@@ -181,73 +183,84 @@ const FaceVectorType& FaceTypeSplitter::getTypedFaceVector(const GeomAbs_Surface
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-FaceAdjacencySplitter::FaceAdjacencySplitter(const TopoDS_Shell& shell)
+FaceAdjacencySplitter::FaceAdjacencySplitter(const Part::TopoShape& shell)
 {
-    TopExp_Explorer shellIt;
-    for (shellIt.Init(shell, TopAbs_FACE); shellIt.More(); shellIt.Next()) {
-        TopTools_ListOfShape shapeList;
+    int faceCount = static_cast<int>(shell.countSubShapes(TopAbs_FACE));
+    faceNeighbours.resize(faceCount + 1);
+    for (int index = 1; index <= faceCount; ++index) {
+        faceMap.Add(shell.findShape(TopAbs_FACE, index));
+    }
+
+    for (int index = 1; index <= faceCount; ++index) {
+        std::vector<int>& neighbours = faceNeighbours[index];
         TopExp_Explorer it;
-        for (it.Init(shellIt.Current(), TopAbs_EDGE); it.More(); it.Next()) {
-            shapeList.Append(it.Current());
+        for (it.Init(faceMap(index), TopAbs_EDGE); it.More(); it.Next()) {
+            for (int other : shell.findAncestors(it.Current(), TopAbs_FACE)) {
+                if (other != index && other > 0
+                    && std::find(neighbours.begin(), neighbours.end(), other) == neighbours.end()) {
+                    neighbours.push_back(other);
+                }
+            }
         }
-        faceToEdgeMap.Add(shellIt.Current(), shapeList);
     }
-    TopExp::MapShapesAndAncestors(shell, TopAbs_EDGE, TopAbs_FACE, edgeToFaceMap);
 }
 
 
 void FaceAdjacencySplitter::split(const FaceVectorType& facesIn)
 {
-    facesInMap.Clear();
-    processedMap.Clear();
     adjacencyArray.clear();
+    processedFaces.assign(faceMap.Extent() + 1, false);
+    selectedFaces.assign(faceMap.Extent() + 1, false);
+
+    std::vector<int> indices;
+    indices.reserve(facesIn.size());
+    for (const auto& face : facesIn) {
+        int index = faceMap.FindIndex(face);
+        if (index > 0) {
+            selectedFaces[index] = true;
+            indices.push_back(index);
+        }
+    }
 
-    FaceVectorType::const_iterator it;
-    for (it = facesIn.begin(); it != facesIn.end(); ++it) {
-        facesInMap.Add(*it);
-    }
-    // the reserve call guarantees the vector will never get "pushed back" in the
-    // recursiveFind calls, thus invalidating the iterators. We can be sure of this as any one
-    // matched set can't be bigger than the set passed in. if we have seg faults, we will
-    // want to turn this tempFaces vector back into a std::list ensuring valid iterators
-    // at the expense of std::find speed.
     FaceVectorType tempFaces;
     tempFaces.reserve(facesIn.size() + 1);
 
-    for (it = facesIn.begin(); it != facesIn.end(); ++it) {
+    for (int index : indices) {
         // skip already processed shapes.
-        if (processedMap.Contains(*it)) {
+        if (processedFaces[index]) {
             continue;
         }
 
         tempFaces.clear();
-        processedMap.Add(*it);
-        recursiveFind(*it, tempFaces);
+        processedFaces[index] = true;
+        findConnected(index, tempFaces);
         if (tempFaces.size() > 1) {
             adjacencyArray.push_back(tempFaces);
         }
     }
 }
 
-void FaceAdjacencySplitter::recursiveFind(const TopoDS_Face& face, FaceVectorType& outVector)
+void FaceAdjacencySplitter::findConnected(int faceIndex, FaceVectorType& outVector)
 {
-    outVector.push_back(face);
-
-    const TopTools_ListOfShape& edges = faceToEdgeMap.FindFromKey(face);
-    TopTools_ListIteratorOfListOfShape edgeIt;
-    for (edgeIt.Initialize(edges); edgeIt.More(); edgeIt.Next()) {
-        const TopTools_ListOfShape& faces = edgeToFaceMap.FindFromKey(edgeIt.Value());
-        TopTools_ListIteratorOfListOfShape faceIt;
-        for (faceIt.Initialize(faces); faceIt.More(); faceIt.Next()) {
-            if (!facesInMap.Contains(faceIt.Value())) {
-                continue;
-            }
-            if (processedMap.Contains(faceIt.Value())) {
-                continue;
-            }
-            processedMap.Add(faceIt.Value());
-            recursiveFind(TopoDS::Face(faceIt.Value()), outVector);
+    // Depth first search in the same order as a recursive walk would visit the faces, but
+    // with an explicit stack so that large face groups can't overflow the call stack.
+    std::vector<std::pair<int, std::size_t>> stack;
+    outVector.push_back(TopoDS::Face(faceMap(faceIndex)));
+    stack.emplace_back(faceIndex, 0);
+    while (!stack.empty()) {
+        auto& [current, position] = stack.back();
+        const std::vector<int>& neighbours = faceNeighbours[current];
+        if (position >= neighbours.size()) {
+            stack.pop_back();
+            continue;
         }
+        int next = neighbours[position++];
+        if (!selectedFaces[next] || processedFaces[next]) {
+            continue;
+        }
+        processedFaces[next] = true;
+        outVector.push_back(TopoDS::Face(faceMap(next)));
+        stack.emplace_back(next, 0);
     }
 }
 
@@ -1130,7 +1143,16 @@ bool FaceUniter::process()
     ModelRefine::FaceVectorType facesToRemove;
     ModelRefine::FaceVectorType facesToSew;
 
-    ModelRefine::FaceAdjacencySplitter adjacencySplitter(workShell);
+    Part::TopoShape shellShape(workShell);
+    ModelRefine::FaceAdjacencySplitter adjacencySplitter(shellShape);
+
+    struct FaceGroup
+    {
+        FaceTypedBase* typeObject;
+        FaceVectorType faces;
+        TopoDS_Face newFace;
+    };
+    std::vector<FaceGroup> groups;
 
     for (typeIt = typeObjects.begin(); typeIt != typeObjects.end(); ++typeIt) {
         ModelRefine::FaceVectorType typedFaces = splitter.getTypedFaceVector((*typeIt)->getType());
@@ -1139,44 +1161,75 @@ bool FaceUniter::process()
         for (std::size_t indexEquality(0); indexEquality < equalitySplitter.getGroupCount();
              ++indexEquality) {
             adjacencySplitter.split(equalitySplitter.getGroup(indexEquality));
-            //            std::cout << "      adjacency group count: " <<
-            //            adjacencySplitter.getGroupCount() << std::endl;
             for (std::size_t adjacentIndex(0); adjacentIndex < adjacencySplitter.getGroupCount();
                  ++adjacentIndex) {
-                //                    std::cout << "         face count is: " <<
-                //                    adjacencySplitter.getGroup(adjacentIndex).size() << std::endl;
-                TopoDS_Face newFace = (*typeIt)->buildFace(adjacencySplitter.getGroup(adjacentIndex));
-                if (!newFace.IsNull()) {
-                    // the created face should have the same orientation as the input faces
-                    const FaceVectorType& faces = adjacencySplitter.getGroup(adjacentIndex);
-                    if (!faces.empty() && newFace.Orientation() != faces[0].Orientation()) {
-                        checkFinalShell = true;
-                    }
-                    facesToSew.push_back(newFace);
-
-                    // This reserve is probably not actually an improvement over letting
-                    // emplace_back allocate as needed. Leaving the code here for study if someone
-                    // wants to measure it. Coverity issue 356645. - chennes, March 2025
-                    // if (facesToRemove.capacity() <= facesToRemove.size() +
-                    // adjacencySplitter.getGroup(adjacentIndex).size())
-                    //    facesToRemove.reserve(facesToRemove.size() +
-                    //    adjacencySplitter.getGroup(adjacentIndex).size());
-
-                    FaceVectorType temp = adjacencySplitter.getGroup(adjacentIndex);
-                    facesToRemove.insert(facesToRemove.end(), temp.begin(), temp.end());
-                    // the first shape will be marked as modified, i.e. replaced by newFace, all
-                    // others are marked as deleted jrheinlaender: IMHO this is not correct because
-                    // references to the deleted faces will be broken, whereas they should be
-                    // replaced by references to the new face. To achieve this all shapes should be
-                    // marked as modified, producing one single new face. This is the inverse
-                    // behaviour to faces that are split e.g. by a boolean cut, where one old shape
-                    // is marked as modified, producing multiple new shapes
-                    if (!temp.empty()) {
-                        for (const auto& f : temp) {
-                            modifiedShapes.emplace_back(f, newFace);
-                        }
-                    }
-                }
+                groups.push_back({*typeIt, adjacencySplitter.getGroup(adjacentIndex), TopoDS_Face()});
+            }
+        }
+    }
+
+    // The groups are independent of each other, except that building a face may update the
+    // tolerance of vertices it shares with a neighbouring group. Put groups that touch the same
+    // vertex into different batches and build the faces of each batch in parallel.
+    std::vector<int> vertexBatch(shellShape.countSubShapes(TopAbs_VERTEX) + 1, 0);
+    std::vector<std::vector<std::size_t>> batches;
+    for (std::size_t index = 0; index < groups.size(); ++index) {
+        std::vector<int> vertices;
+        for (const auto& face : groups[index].faces) {
+            TopExp_Explorer it;
+            for (it.Init(face, TopAbs_VERTEX); it.More(); it.Next()) {
+                vertices.push_back(shellShape.findShape(it.Current()));
+            }
+        }
+        int batch = 0;
+        for (int vertex : vertices) {
+            batch = std::max(batch, vertexBatch[vertex]);
+        }
+        for (int vertex : vertices) {
+            vertexBatch[vertex] = batch + 1;
+        }
+        if (batch >= static_cast<int>(batches.size())) {
+            batches.resize(batch + 1);
+        }
+        batches[batch].push_back(index);
+    }
+
+    std::atomic<bool> buildFailed(false);
+    for (const auto& batch : batches) {
+        OSD_Parallel::For(0, static_cast<int>(batch.size()), [&](int i) {
+            FaceGroup& group = groups[batch[i]];
+            try {
+                group.newFace = group.typeObject->buildFace(group.faces);
+            }
+            catch (Standard_Failure&) {
+                buildFailed = true;
+            }
+        });
+    }
+    if (buildFailed) {
+        return false;
+    }
+
+    for (const auto& group : groups) {
+        const TopoDS_Face& newFace = group.newFace;
+        if (!newFace.IsNull()) {
+            // the created face should have the same orientation as the input faces
+            const FaceVectorType& faces = group.faces;
+            if (!faces.empty() && newFace.Orientation() != faces[0].Orientation()) {
+                checkFinalShell = true;
+            }
+            facesToSew.push_back(newFace);
+
+            facesToRemove.insert(facesToRemove.end(), faces.begin(), faces.end());
+            // the first shape will be marked as modified, i.e. replaced by newFace, all
+            // others are marked as deleted jrheinlaender: IMHO this is not correct because
+            // references to the deleted faces will be broken, whereas they should be
+            // replaced by references to the new face. To achieve this all shapes should be
+            // marked as modified, producing one single new face. This is the inverse
+            // behaviour to faces that are split e.g. by a boolean cut, where one old shape
+            // is marked as modified, producing multiple new shapes
+            for (const auto& f : faces) {
+                modifiedShapes.emplace_back(f, newFace);
             }
         }
     }
@@ -37,12 +37,18 @@
 
 #include <TopTools_DataMapOfShapeListOfShape.hxx>
 #include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 #include <TopTools_ListOfShape.hxx>
 #include <TopTools_MapOfShape.hxx>
 
 #include <Mod/Part/PartGlobal.h>
 
 
+namespace Part
+{
+class TopoShape;
+}
+
 namespace ModelRefine
 {
 using FaceVectorType = std::vector<TopoDS_Face>;
@@ -145,7 +151,9 @@ private:
 class FaceAdjacencySplitter
 {
 public:
-    FaceAdjacencySplitter(const TopoDS_Shell& shell);
+    /// Builds the face adjacency graph of the shell once, using the ancestor maps cached by
+    /// the shell's TopoShapeCache.
+    FaceAdjacencySplitter(const Part::TopoShape& shell);
     void split(const FaceVectorType& facesIn);
     std::size_t getGroupCount() const
     {
@@ -158,13 +166,15 @@ public:
 
 private:
     FaceAdjacencySplitter() = default;
-    void recursiveFind(const TopoDS_Face& face, FaceVectorType& outVector);
+    void findConnected(int faceIndex, FaceVectorType& outVector);
     std::vector<FaceVectorType> adjacencyArray;
-    TopTools_MapOfShape processedMap;
-    TopTools_MapOfShape facesInMap;
+    std::vector<bool> processedFaces;
+    std::vector<bool> selectedFaces;
 
-    TopTools_IndexedDataMapOfShapeListOfShape faceToEdgeMap;
-    TopTools_IndexedDataMapOfShapeListOfShape edgeToFaceMap;
+    /// Faces of the shell, index based as in TopoShapeCache
+    TopTools_IndexedMapOfShape faceMap;
+    /// For every face index the indices of the faces sharing an edge with it
+    std::vector<std::vector<int>> faceNeighbours;
 };
 
 class FaceEqualitySplitter
@@ -34,15 +34,19 @@
 #endif
 #include <algorithm>
 #include <limits>
+#include <Inventor/SbBox3f.h>
 #include <Inventor/SoPickedPoint.h>
 #include <Inventor/SoPrimitiveVertex.h>
 #include <Inventor/actions/SoGetBoundingBoxAction.h>
 #include <Inventor/actions/SoGLRenderAction.h>
+#include <Inventor/actions/SoRayPickAction.h>
 #include <Inventor/bundles/SoMaterialBundle.h>
 #include <Inventor/details/SoLineDetail.h>
+#include <Inventor/details/SoPointDetail.h>
 #include <Inventor/elements/SoCoordinateElement.h>
 #include <Inventor/elements/SoGLCoordinateElement.h>
 #include <Inventor/elements/SoLineWidthElement.h>
+#include <Inventor/elements/SoPickStyleElement.h>
 #include <Inventor/errors/SoDebugError.h>
 #include <Inventor/misc/SoState.h>
 #include <Inventor/nodes/SoGroup.h>
@@ -50,6 +54,7 @@
 
 #include <Gui/Selection/SoFCUnifiedSelection.h>
 #include <Gui/Selection/Selection.h>
+#include <Base/BoundBoxTree.h>
 #include <Base/Console.h>
 #include "SoBrepEdgeSet.h"
 #include "SoBrepFaceSet.h"
@@ -77,8 +82,16 @@ SoBrepEdgeSet::SoBrepEdgeSet()
     , selContext2(std::make_shared<SelContext>())
 {
     SO_NODE_CONSTRUCTOR(SoBrepEdgeSet);
+
+    // the pick tree is stale whenever the indices change, even if their number stays the same
+    coordIndexSensor.setFunction(&SoBrepEdgeSet::coordIndexChangedCB);
+    coordIndexSensor.setData(this);
+    coordIndexSensor.setPriority(0);
+    coordIndexSensor.attach(&coordIndex);
 }
 
+SoBrepEdgeSet::~SoBrepEdgeSet() = default;
+
 void SoBrepEdgeSet::GLRender(SoGLRenderAction* action)
 {
     auto state = action->getState();
@@ -761,3 +774,128 @@ SoDetail* SoBrepEdgeSet::createLineSegmentDetail(
     line_detail->setPartIndex(index);
     return detail;
 }
+
+/**
+ * Picks the line segments within the pick radius of the ray. Only the segments whose bounding
+ * box is cut by the pick volume are tested, they are looked up in a tree of the segment boxes
+ * that is built on the first pick after the coordinates have changed.
+ */
+void SoBrepEdgeSet::rayPick(SoRayPickAction* action)
+{
+    SoState* state = action->getState();
+    SoPickStyleElement::Style style = SoPickStyleElement::get(state);
+    bool pickShape = style == SoPickStyleElement::SHAPE
+        || style == SoPickStyleElement::SHAPE_ON_TOP;
+    const Base::BoundBoxTree* tree = nullptr;
+    if (pickShape && !this->vertexProperty.getValue()) {
+        tree = getPickTree(state);
+    }
+    if (!tree) {
+        inherited::rayPick(action);
+        return;
+    }
+    if (!shouldRayPick(action)) {
+        return;
+    }
+
+    action->setObjectSpace();
+
+    const SoCoordinateElement* coords = SoCoordinateElement::getInstance(state);
+    const int32_t* cindices = this->coordIndex.getValues(0);
+
+    auto testBox = [action](const Base::BoundBox3f& box) {
+        // the pick volume includes the pick radius around the ray
+        SbBox3f bbox(box.MinX, box.MinY, box.MinZ, box.MaxX, box.MaxY, box.MaxZ);
+        return action->intersect(bbox);
+    };
+    auto testSegment = [&](std::size_t index) {
+        const auto& segment = pickSegments[index];
+        int32_t index0 = cindices[segment.first];
+        int32_t index1 = cindices[segment.first + 1];
+        SbVec3f point;
+        if (!action->intersect(coords->get3(index0), coords->get3(index1), point)
+            || !action->isBetweenPlanes(point)) {
+            return true;
+        }
+
+        SoPickedPoint* pp = action->addIntersection(point);
+        if (!pp) {
+            return true;
+        }
+
+        // Same details as createLineSegmentDetail() creates
+        auto detail = new SoLineDetail();
+        detail->setLineIndex(segment.second);
+        detail->setPartIndex(segment.second);
+        SoPointDetail pointDetail;
+        pointDetail.setCoordinateIndex(index0);
+        detail->setPoint0(&pointDetail);
+        pointDetail.setCoordinateIndex(index1);
+        detail->setPoint1(&pointDetail);
+        pp->setDetail(detail, this);
+        return true;
+    };
+
+    tree->traverse(testBox, testSegment);
+}
+
+/**
+ * Returns the tree of the segment boxes for the current coordinates. It is rebuilt whenever
+ * the coordinate node or the coordinate indices have changed. If the coordinate indices are out
+ * of range null is returned.
+ */
+const Base::BoundBoxTree* SoBrepEdgeSet::getPickTree(SoState* state)
+{
+    const SoCoordinateElement* coords = SoCoordinateElement::getInstance(state);
+    if (pickCoordsId == coords->getNodeId()) {
+        return pickTree.get();
+    }
+
+    pickTree.reset();
+    pickSegments.clear();
+    pickCoordsId = coords->getNodeId();
+    int numindices = this->coordIndex.getNum();
+
+    const int32_t* cindices = this->coordIndex.getValues(0);
+    int numcoords = coords->getNum();
+    std::vector<Base::BoundBox3f> boxes;
+    boxes.reserve(numindices);
+    pickSegments.reserve(numindices);
+
+    // a line ends at each negative index, like in SoIndexedLineSet
+    int32_t line = 0;
+    for (int i = 0; i < numindices; i++) {
+        int32_t index = cindices[i];
+        if (index < 0) {
+            line++;
+            continue;
+        }
+        if (index >= numcoords) {
+            pickSegments.clear();
+            return nullptr;
+        }
+        if (i == 0 || cindices[i - 1] < 0) {
+            continue;
+        }
+        const SbVec3f& p0 = coords->get3(cindices[i - 1]);
+        const SbVec3f& p1 = coords->get3(index);
+        Base::BoundBox3f box;
+        box.Add(Base::Vector3f(p0[0], p0[1], p0[2]));
+        box.Add(Base::Vector3f(p1[0], p1[1], p1[2]));
+        boxes.push_back(box);
+        pickSegments.emplace_back(i - 1, line);
+    }
+
+    if (boxes.empty()) {
+        return nullptr;
+    }
+    pickTree = std::make_unique<Base::BoundBoxTree>(boxes);
+    return pickTree.get();
+}
+
+void SoBrepEdgeSet::coordIndexChangedCB(void* data, SoSensor*)
+{
+    auto self = static_cast<SoBrepEdgeSet*>(data);
+    self->pickTree.reset();
+    self->pickCoordsId = 0;
+}
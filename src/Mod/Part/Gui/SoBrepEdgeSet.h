@@ -26,7 +26,9 @@
 
 #include <boost/algorithm/string/predicate.hpp>
 #include <Inventor/nodes/SoIndexedLineSet.h>
+#include <Inventor/sensors/SoFieldSensor.h>
 #include <memory>
+#include <utility>
 #include <vector>
 #include <Gui/Selection/SoFCSelectionContext.h>
 #include <Mod/Part/PartGlobal.h>
@@ -36,6 +38,11 @@ class SoCoordinateElement;
 class SoGLCoordinateElement;
 class SoTextureCoordinateBundle;
 
+namespace Base
+{
+class BoundBoxTree;
+}
+
 namespace PartGui
 {
 
@@ -57,7 +64,7 @@ public:
     }
 
 protected:
-    ~SoBrepEdgeSet() override = default;
+    ~SoBrepEdgeSet() override;
     void GLRender(SoGLRenderAction* action) override;
     void GLRenderBelowPath(SoGLRenderAction* action) override;
     void doAction(SoAction* action) override;
@@ -69,6 +76,7 @@ protected:
     ) override;
 
     void getBoundingBox(SoGetBoundingBoxAction* action) override;
+    void rayPick(SoRayPickAction* action) override;
 
 private:
     struct SelContext;
@@ -82,6 +90,8 @@ private:
     void renderHighlight(SoGLRenderAction* action, SelContextPtr);
     void renderSelection(SoGLRenderAction* action, SelContextPtr, bool push = true);
     bool validIndexes(const SoCoordinateElement*, const std::vector<int32_t>&) const;
+    const Base::BoundBoxTree* getPickTree(SoState* state);
+    static void coordIndexChangedCB(void* data, SoSensor*);
 
 
 private:
@@ -90,6 +100,13 @@ private:
     Gui::SoFCSelectionCounter selCounter;
     uint32_t packedColor {0};
 
+    // Segment boxes for picking, built on demand for the coordinates they were built from
+    std::unique_ptr<Base::BoundBoxTree> pickTree;
+    // the position of the first point of each segment in coordIndex and the index of its line
+    std::vector<std::pair<int32_t, int32_t>> pickSegments;
+    SbUniqueId pickCoordsId {0};
+    SoFieldSensor coordIndexSensor;
+
     // backreference to viewprovider that owns this node
     ViewProviderPartExt* viewProvider = nullptr;
 };
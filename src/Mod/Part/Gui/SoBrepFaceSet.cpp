@@ -33,10 +33,12 @@
 #include <algorithm>
 #include <limits>
 #include <map>
+#include <Inventor/SbBox3f.h>
 #include <Inventor/SoPickedPoint.h>
 #include <Inventor/SoPrimitiveVertex.h>
 #include <Inventor/actions/SoGetBoundingBoxAction.h>
 #include <Inventor/actions/SoGLRenderAction.h>
+#include <Inventor/actions/SoRayPickAction.h>
 #include <Inventor/bundles/SoMaterialBundle.h>
 #include <Inventor/bundles/SoTextureCoordinateBundle.h>
 #include <Inventor/elements/SoLazyElement.h>
@@ -45,8 +47,11 @@
 #include <Inventor/elements/SoGLCoordinateElement.h>
 #include <Inventor/elements/SoGLCacheContextElement.h>
 #include <Inventor/elements/SoGLVBOElement.h>
+#include <Inventor/elements/SoNormalElement.h>
+#include <Inventor/elements/SoPickStyleElement.h>
 #include <Inventor/errors/SoDebugError.h>
 #include <Inventor/details/SoFaceDetail.h>
+#include <Inventor/details/SoPointDetail.h>
 #include <Inventor/misc/SoState.h>
 #include <Inventor/misc/SoContextHandler.h>
 #include <Inventor/elements/SoCacheElement.h>
@@ -68,6 +73,7 @@
 // Should come after glext.h to avoid warnings
 #include <Inventor/C/glue/gl.h>
 
+#include <Base/BoundBoxTree.h>
 #include <Base/Profiler.h>
 
 #include <Gui/SoFCInteractiveElement.h>
@@ -181,6 +187,12 @@ SoBrepFaceSet::SoBrepFaceSet()
     packedColor = 0;
 
     pimpl = std::make_unique<VBO>();
+
+    // the pick tree is stale whenever the indices change, even if their number stays the same
+    coordIndexSensor.setFunction(&SoBrepFaceSet::coordIndexChangedCB);
+    coordIndexSensor.setData(this);
+    coordIndexSensor.setPriority(0);
+    coordIndexSensor.attach(&coordIndex);
 }
 
 SoBrepFaceSet::~SoBrepFaceSet() = default;
@@ -2201,21 +2213,182 @@ SoDetail* SoBrepFaceSet::createTriangleDetail(
 )
 {
     SoDetail* detail = inherited::createTriangleDetail(action, v1, v2, v3, pp);
+    SoFaceDetail* face_detail = static_cast<SoFaceDetail*>(detail);
+    int part = findPartIndex(face_detail->getFaceIndex());
+    if (part >= 0) {
+        face_detail->setPartIndex(part);
+    }
+    return detail;
+}
+
+/**
+ * Returns the part the triangle \a faceIndex belongs to or -1 if it doesn't belong to any.
+ */
+int SoBrepFaceSet::findPartIndex(int faceIndex) const
+{
     const int32_t* indices = this->partIndex.getValues(0);
     int num = this->partIndex.getNum();
     if (indices) {
-        SoFaceDetail* face_detail = static_cast<SoFaceDetail*>(detail);
-        int index = face_detail->getFaceIndex();
         int count = 0;
         for (int i = 0; i < num; i++) {
             count += indices[i];
-            if (index < count) {
-                face_detail->setPartIndex(i);
-                break;
+            if (faceIndex < count) {
+                return i;
             }
         }
     }
-    return detail;
+    return -1;
+}
+
+/**
+ * Picks the triangles hit by the ray. Only the triangles whose bounding box is cut by the pick
+ * volume are tested, they are looked up in a tree of the triangle boxes that is built on the
+ * first pick after the coordinates have changed.
+ */
+void SoBrepFaceSet::rayPick(SoRayPickAction* action)
+{
+    SoState* state = action->getState();
+    SoPickStyleElement::Style style = SoPickStyleElement::get(state);
+    bool pickShape = style == SoPickStyleElement::SHAPE
+        || style == SoPickStyleElement::SHAPE_ON_TOP;
+    const Base::BoundBoxTree* tree = nullptr;
+    if (pickShape && !this->vertexProperty.getValue()) {
+        tree = getPickTree(state);
+    }
+    if (!tree) {
+        inherited::rayPick(action);
+        return;
+    }
+    if (!shouldRayPick(action)) {
+        return;
+    }
+
+    action->setObjectSpace();
+
+    const SoCoordinateElement* coords = SoCoordinateElement::getInstance(state);
+    const int32_t* cindices = this->coordIndex.getValues(0);
+
+    // The shape nodes of ViewProviderPartExt have a normal per vertex, interpolate them like
+    // SoShape does
+    const SoNormalElement* normals = SoNormalElement::getInstance(state);
+    const int32_t* nindices = cindices;
+    if (this->normalIndex.getNum() >= this->coordIndex.getNum() && this->normalIndex[0] >= 0) {
+        nindices = this->normalIndex.getValues(0);
+    }
+    bool vertexNormals = this->findNormalBinding(state) == PER_VERTEX_INDEXED;
+
+    auto testBox = [action](const Base::BoundBox3f& box) {
+        SbBox3f bbox(box.MinX, box.MinY, box.MinZ, box.MaxX, box.MaxY, box.MaxZ);
+        return action->intersect(bbox);
+    };
+    auto testTriangle = [&](std::size_t index) {
+        // the tree is only built for coordinate indices of triangles
+        const int32_t* triangle = cindices + 4 * index;
+        const SbVec3f& v0 = coords->get3(triangle[0]);
+        const SbVec3f& v1 = coords->get3(triangle[1]);
+        const SbVec3f& v2 = coords->get3(triangle[2]);
+        SbVec3f point;
+        SbVec3f barycentric;
+        SbBool front {};
+        if (!action->intersect(v0, v1, v2, point, barycentric, front)
+            || !action->isBetweenPlanes(point)) {
+            return true;
+        }
+
+        SoPickedPoint* pp = action->addIntersection(point);
+        if (!pp) {
+            return true;
+        }
+
+        const int32_t* normal = nindices + 4 * index;
+        bool hasNormals = vertexNormals;
+        for (int i = 0; i < 3; i++) {
+            hasNormals = hasNormals && normal[i] >= 0 && normal[i] < normals->getNum();
+        }
+        SbVec3f objectNormal;
+        if (hasNormals) {
+            objectNormal = normals->get(normal[0]) * barycentric[0]
+                + normals->get(normal[1]) * barycentric[1]
+                + normals->get(normal[2]) * barycentric[2];
+        }
+        else {
+            objectNormal = (v1 - v0).cross(v2 - v0);
+        }
+        objectNormal.normalize();
+        pp->setObjectNormal(objectNormal);
+
+        auto detail = new SoFaceDetail();
+        auto faceIndex = static_cast<int>(index);
+        detail->setFaceIndex(faceIndex);
+        int part = findPartIndex(faceIndex);
+        if (part >= 0) {
+            detail->setPartIndex(part);
+        }
+        detail->setNumPoints(3);
+        SoPointDetail pointDetail;
+        for (int i = 0; i < 3; i++) {
+            pointDetail.setCoordinateIndex(triangle[i]);
+            if (hasNormals) {
+                pointDetail.setNormalIndex(normal[i]);
+            }
+            detail->setPoint(i, &pointDetail);
+        }
+        pp->setDetail(detail, this);
+        return true;
+    };
+
+    tree->traverse(testBox, testTriangle);
+}
+
+/**
+ * Returns the tree of the triangle boxes for the current coordinates. It is rebuilt whenever
+ * the coordinate node or the coordinate indices have changed. If the coordinate indices don't
+ * consist of triangles only null is returned.
+ */
+const Base::BoundBoxTree* SoBrepFaceSet::getPickTree(SoState* state)
+{
+    const SoCoordinateElement* coords = SoCoordinateElement::getInstance(state);
+    if (pickCoordsId == coords->getNodeId()) {
+        return pickTree.get();
+    }
+
+    pickTree.reset();
+    pickCoordsId = coords->getNodeId();
+    int numindices = this->coordIndex.getNum();
+
+    if (numindices < 4 || numindices % 4 != 0) {
+        return nullptr;
+    }
+
+    const int32_t* cindices = this->coordIndex.getValues(0);
+    int numcoords = coords->getNum();
+    std::vector<Base::BoundBox3f> boxes;
+    boxes.reserve(numindices / 4);
+    for (int i = 0; i < numindices; i += 4) {
+        Base::BoundBox3f box;
+        for (int j = 0; j < 3; j++) {
+            int32_t index = cindices[i + j];
+            if (index < 0 || index >= numcoords) {
+                return nullptr;
+            }
+            const SbVec3f& point = coords->get3(index);
+            box.Add(Base::Vector3f(point[0], point[1], point[2]));
+        }
+        if (cindices[i + 3] >= 0) {
+            return nullptr;
+        }
+        boxes.push_back(box);
+    }
+
+    pickTree = std::make_unique<Base::BoundBoxTree>(boxes);
+    return pickTree.get();
+}
+
+void SoBrepFaceSet::coordIndexChangedCB(void* data, SoSensor*)
+{
+    auto self = static_cast<SoBrepFaceSet*>(data);
+    self->pickTree.reset();
+    self->pickCoordsId = 0;
 }
 
 SoBrepFaceSet::Binding SoBrepFaceSet::findMaterialBinding(SoState* const state) const
@@ -27,6 +27,7 @@
 #include <Inventor/fields/SoMFInt32.h>
 #include <Inventor/fields/SoSFInt32.h>
 #include <Inventor/nodes/SoIndexedFaceSet.h>
+#include <Inventor/sensors/SoFieldSensor.h>
 #include <memory>
 #include <vector>
 #include <Gui/Selection/SoFCSelectionContext.h>
@@ -36,6 +37,11 @@
 class SoGLCoordinateElement;
 class SoTextureCoordinateBundle;
 
+namespace Base
+{
+class BoundBoxTree;
+}
+
 
 namespace PartGui
 {
@@ -111,6 +117,7 @@ protected:
     ) override;
     void generatePrimitives(SoAction* action) override;
     void getBoundingBox(SoGetBoundingBoxAction* action) override;
+    void rayPick(SoRayPickAction* action) override;
 
 private:
     enum Binding
@@ -126,6 +133,9 @@ private:
     };
     Binding findMaterialBinding(SoState* const state) const;
     Binding findNormalBinding(SoState* const state) const;
+    int findPartIndex(int faceIndex) const;
+    const Base::BoundBoxTree* getPickTree(SoState* state);
+    static void coordIndexChangedCB(void* data, SoSensor*);
     void renderShape(
         SoGLRenderAction* action,
         SbBool hasVBO,
@@ -174,6 +184,11 @@ private:
     class VBO;
     std::unique_ptr<VBO> pimpl;
 
+    // Triangle boxes for picking, built on demand for the coordinates they were built from
+    std::unique_ptr<Base::BoundBoxTree> pickTree;
+    SbUniqueId pickCoordsId {0};
+    SoFieldSensor coordIndexSensor;
+
     // backreference to viewprovider that owns this node
     ViewProviderPartExt* viewProvider = nullptr;
 };
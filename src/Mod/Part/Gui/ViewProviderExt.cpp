@@ -78,6 +78,7 @@
 
 #include <Gui/BitmapFactory.h>
 #include <Gui/Control.h>
+#include <Gui/Selection/ProjectedElementIndex.h>
 #include <Gui/Selection/SoFCSelectionAction.h>
 #include <Gui/Selection/SoFCUnifiedSelection.h>
 #include <Gui/ViewParams.h>
@@ -684,6 +685,117 @@ std::vector<Base::Vector3d> ViewProviderPartExt::getSelectionShape(const char* /
     return {};
 }
 
+// Creates the index of the faces of the tessellation, or of the edges if there are no faces, or
+// of the vertexes if there are no edges either, as box selection considers only the first type
+// that the shape has. Returns an empty index if the nodes are inconsistent.
+static std::unique_ptr<Gui::ProjectedElementIndex> createElementIndex(
+    const SoCoordinate3* coords,
+    const SoBrepFaceSet* faceset,
+    const SoBrepEdgeSet* lineset,
+    const SoBrepPointSet* nodeset
+)
+{
+    using Primitive = Gui::ProjectedElementIndex::Primitive;
+
+    int numPoints = coords->point.getNum();
+    const SbVec3f* verts = coords->point.getValues(0);
+    std::vector<Base::Vector3f> points;
+    points.reserve(numPoints);
+    for (int i = 0; i < numPoints; i++) {
+        points.emplace_back(verts[i][0], verts[i][1], verts[i][2]);
+    }
+
+    auto isValid = [numPoints](int32_t index) {
+        return index >= 0 && index < numPoints;
+    };
+
+    int numFaces = faceset->partIndex.getNum();
+    int numEdgeIndices = lineset->coordIndex.getNum();
+    if (numFaces > 0) {
+        auto index = std::make_unique<Gui::ProjectedElementIndex>(
+            "Face",
+            Primitive::Triangles,
+            std::move(points)
+        );
+
+        // the faces are made of triangles of the form a,b,c,-1
+        const int32_t* parts = faceset->partIndex.getValues(0);
+        const int32_t* cindices = faceset->coordIndex.getValues(0);
+        int numIndices = faceset->coordIndex.getNum();
+        std::vector<int32_t> corners;
+        int pos = 0;
+        for (int i = 0; i < numFaces; i++) {
+            corners.clear();
+            for (int j = 0; j < parts[i]; j++, pos += 4) {
+                if (pos + 3 > numIndices || !isValid(cindices[pos]) || !isValid(cindices[pos + 1])
+                    || !isValid(cindices[pos + 2])) {
+                    return std::make_unique<Gui::ProjectedElementIndex>();
+                }
+                corners.insert(corners.end(), cindices + pos, cindices + pos + 3);
+            }
+            index->addElement(corners.data(), corners.size());
+        }
+        return index;
+    }
+
+    if (numEdgeIndices > 0) {
+        auto index = std::make_unique<Gui::ProjectedElementIndex>(
+            "Edge",
+            Primitive::Polylines,
+            std::move(points)
+        );
+
+        // the edges are polylines separated by -1
+        const int32_t* cindices = lineset->coordIndex.getValues(0);
+        int first = 0;
+        for (int i = 0; i < numEdgeIndices; i++) {
+            if (cindices[i] < 0) {
+                index->addElement(cindices + first, i - first);
+                first = i + 1;
+            }
+            else if (!isValid(cindices[i])) {
+                return std::make_unique<Gui::ProjectedElementIndex>();
+            }
+        }
+        return index;
+    }
+
+    int start = nodeset->startIndex.getValue();
+    auto index = std::make_unique<Gui::ProjectedElementIndex>(
+        "Vertex",
+        Primitive::Points,
+        std::move(points)
+    );
+    for (int32_t i = std::max(start, 0); i < numPoints; i++) {
+        index->addElement(&i, 1);
+    }
+    return index;
+}
+
+bool ViewProviderPartExt::getElementsInPolygon(
+    const Base::ViewProjMethod& proj,
+    const Base::Polygon2d& polygon,
+    const Base::Matrix4D& mat,
+    bool center,
+    std::vector<std::string>& elements
+) const
+{
+    // the tessellation is out of date
+    if (VisualTouched) {
+        return false;
+    }
+
+    if (!elementIndex) {
+        elementIndex = createElementIndex(coords, faceset, lineset, nodeset);
+    }
+    if (elementIndex->empty()) {
+        return false;
+    }
+
+    elements = elementIndex->select(proj, mat, polygon, center);
+    return true;
+}
+
 void ViewProviderPartExt::setHighlightedFaces(const std::vector<App::Material>& materials)
 {
     if (getObject() && getObject()->testStatus(App::ObjectStatus::TouchOnColorChange)) {
@@ -1506,6 +1618,7 @@ void ViewProviderPartExt::updateVisual()
         );
 
         lastRenderedShape = shape;
+        elementIndex.reset();
 
         VisualTouched = false;
     }
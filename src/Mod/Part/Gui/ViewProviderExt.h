@@ -28,6 +28,7 @@
 
 
 #include <map>
+#include <memory>
 
 #include <App/PropertyUnits.h>
 #include <Gui/ViewProviderGeometryObject.h>
@@ -58,6 +59,11 @@ class SoNormalBinding;
 class SoMaterialBinding;
 class SoIndexedLineSet;
 
+namespace Gui
+{
+class ProjectedElementIndex;
+}
+
 namespace PartGui
 {
 
@@ -129,6 +135,14 @@ public:
     std::vector<Base::Vector3d> getModelPoints(const SoPickedPoint*) const override;
     /// return the highlight lines for a given element or the whole shape
     std::vector<Base::Vector3d> getSelectionShape(const char* Element) const override;
+    /// return the elements inside a selection polygon using the tessellation
+    bool getElementsInPolygon(
+        const Base::ViewProjMethod& proj,
+        const Base::Polygon2d& polygon,
+        const Base::Matrix4D& mat,
+        bool center,
+        std::vector<std::string>& elements
+    ) const override;
     //@}
 
     virtual Part::TopoShape getRenderedShape() const
@@ -256,6 +270,9 @@ private:
 
     // shape that was last rendered so if it does not change we don't re-render it without need
     TopoDS_Shape lastRenderedShape;
+
+    // the elements of the rendered tessellation for box selection, created on demand
+    mutable std::unique_ptr<Gui::ProjectedElementIndex> elementIndex;
 };
 
 }  // namespace PartGui
@@ -4,7 +4,7 @@ from __future__ import annotations
 
 from typing import Any, Final
 
-from Base.Metadata import constmethod, export
+from Base.Metadata import constmethod, export, class_declarations
 from Data import object
 
 @export(
@@ -17,6 +17,11 @@ from Data import object
     FatherNamespace="Data",
     Constructor=True,
 )
+@class_declarations(
+    """
+    private:
+    friend class PropertyPointKernel;"""
+)
 class Points(object):
     """
     Points() -- Create an empty points object.
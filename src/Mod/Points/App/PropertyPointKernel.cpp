@@ -43,13 +43,43 @@ PropertyPointKernel::PropertyPointKernel()
     : _cPoints(new PointKernel())
 {}
 
+PropertyPointKernel::~PropertyPointKernel()
+{
+    if (pointsPyObject) {
+        Py_DECREF(pointsPyObject);
+    }
+}
+
 void PropertyPointKernel::setValue(const PointKernel& m)
 {
     aboutToSetValue();
-    *_cPoints = m;
+    if (pointsShare.use_count() > 1) {
+        // the shared kernel is replaced as a whole, there is no need to copy it first
+        setKernel(new PointKernel(m));
+    }
+    else {
+        *_cPoints = m;
+    }
     hasSetValue();
 }
 
+void PropertyPointKernel::setKernel(PointKernel* points, std::shared_ptr<int> share)
+{
+    _cPoints = points;
+    pointsShare = std::move(share);
+    if (pointsPyObject) {
+        // keep the Python wrapper on the kernel of this property
+        pointsPyObject->setTwinPointer(points);
+    }
+}
+
+void PropertyPointKernel::detachKernel()
+{
+    if (pointsShare.use_count() > 1) {
+        setKernel(new PointKernel(*_cPoints));
+    }
+}
+
 const PointKernel& PropertyPointKernel::getValue() const
 {
     return *_cPoints;
@@ -62,6 +92,7 @@ const Data::ComplexGeoData* PropertyPointKernel::getComplexData() const
 
 void PropertyPointKernel::setTransform(const Base::Matrix4D& rclTrf)
 {
+    detachKernel();
     _cPoints->setTransform(rclTrf);
 }
 
@@ -77,9 +108,13 @@ Base::BoundBox3d PropertyPointKernel::getBoundingBox() const
 
 PyObject* PropertyPointKernel::getPyObject()
 {
-    PointsPy* points = new PointsPy(&*_cPoints);
-    points->setConst();  // set immutable
-    return points;
+    if (!pointsPyObject) {
+        pointsPyObject = new PointsPy(&*_cPoints);
+        pointsPyObject->setConst();  // set immutable
+    }
+
+    Py_INCREF(pointsPyObject);
+    return pointsPyObject;
 }
 
 void PropertyPointKernel::setPyObject(PyObject* value)
@@ -115,6 +150,7 @@ void PropertyPointKernel::Restore(Base::XMLReader& reader)
         mtrx.fromString(Matrix);
 
         aboutToSetValue();
+        detachKernel();
         _cPoints->setTransform(mtrx);
         hasSetValue();
     }
@@ -129,14 +165,18 @@ void PropertyPointKernel::SaveDocFile(Base::Writer& writer) const
 void PropertyPointKernel::RestoreDocFile(Base::Reader& reader)
 {
     aboutToSetValue();
+    detachKernel();
     _cPoints->RestoreDocFile(reader);
     hasSetValue();
 }
 
 App::Property* PropertyPointKernel::Copy() const
 {
+    // Reference the same kernel, it gets copied by the first of the two properties that is
+    // modified. So a transaction does not copy points that are not changed.
     PropertyPointKernel* prop = new PropertyPointKernel();
-    (*prop->_cPoints) = (*this->_cPoints);
+    prop->_cPoints = this->_cPoints;
+    prop->pointsShare = this->pointsShare;
     return prop;
 }
 
@@ -144,7 +184,7 @@ void PropertyPointKernel::Paste(const App::Property& from)
 {
     aboutToSetValue();
     const PropertyPointKernel& prop = dynamic_cast<const PropertyPointKernel&>(from);
-    *(this->_cPoints) = *(prop._cPoints);
+    setKernel(prop._cPoints, prop.pointsShare);
     hasSetValue();
 }
 
@@ -156,6 +196,7 @@ unsigned int PropertyPointKernel::getMemSize() const
 PointKernel* PropertyPointKernel::startEditing()
 {
     aboutToSetValue();
+    detachKernel();
     return static_cast<PointKernel*>(_cPoints);
 }
 
@@ -199,6 +240,7 @@ void PropertyPointKernel::removeIndices(const std::vector<unsigned long>& uIndic
 void PropertyPointKernel::transformGeometry(const Base::Matrix4D& rclMat)
 {
     aboutToSetValue();
+    detachKernel();
     _cPoints->transformGeometry(rclMat);
     hasSetValue();
 }
@@ -25,11 +25,15 @@
 
 #pragma once
 
+#include <memory>
+
 #include "Points.h"
 
 namespace Points
 {
 
+class PointsPy;
+
 /** The point kernel property
  */
 class PointsExport PropertyPointKernel: public App::PropertyComplexGeoData
@@ -38,6 +42,12 @@ class PointsExport PropertyPointKernel: public App::PropertyComplexGeoData
 
 public:
     PropertyPointKernel();
+    ~PropertyPointKernel() override;
+
+    PropertyPointKernel(const PropertyPointKernel&) = delete;
+    PropertyPointKernel(PropertyPointKernel&&) = delete;
+    PropertyPointKernel& operator=(const PropertyPointKernel&) = delete;
+    PropertyPointKernel& operator=(PropertyPointKernel&&) = delete;
 
     /** @name Getter/setter */
     //@{
@@ -89,7 +99,18 @@ public:
     //@}
 
 private:
+    /// Replaces the referenced point kernel, also in the Python wrapper
+    void setKernel(PointKernel* points, std::shared_ptr<int> share = std::make_shared<int>());
+    /// Copies the point kernel before modifying it if it is shared with a copy of this property
+    void detachKernel();
+
+private:
+    // The point kernel may be shared with copies of this property, e.g. the ones kept by the
+    // undo/redo transactions, which then also share pointsShare. The kernel must be detached
+    // before modifying it.
     Base::Reference<PointKernel> _cPoints;
+    std::shared_ptr<int> pointsShare {std::make_shared<int>()};
+    PointsPy* pointsPyObject {nullptr};
 };
 
 }  // namespace Points
@@ -73,6 +73,7 @@ Sketch::Sketch()
     , GCSsys()
     , ConstraintsCounter(0)
     , isInitMove(false)
+    , isWarmMove(false)
     , isFine(true)
     , moveStep(0)
     , defaultSolver(GCS::DogLeg)
@@ -130,6 +131,7 @@ void Sketch::clear()
 
     GCSsys.clear();
     isInitMove = false;
+    isWarmMove = false;
     ConstraintsCounter = 0;
     Conflicting.clear();
     Redundant.clear();
@@ -4881,7 +4883,13 @@ int Sketch::internalSolve(std::string& solvername, int level)
 
     if (isInitMove) {
         solvername = "DogLeg";  // DogLeg is used for dragging (same as before)
-        ret = GCSsys.solve(isFine, GCS::DogLeg);
+        if (isWarmMove) {
+            // only the dragged clusters, starting from the previous drag step
+            ret = GCSsys.solveTemporary(isFine, GCS::DogLeg);
+        }
+        if (!isWarmMove || ret != GCS::Success) {
+            ret = GCSsys.solve(isFine, GCS::DogLeg);
+        }
     }
     else {
         switch (defaultSolver) {
@@ -4924,6 +4932,9 @@ int Sketch::internalSolve(std::string& solvername, int level)
         }
     }
 
+    // an invalid solution was undone to the reference, so the next drag step starts over
+    isWarmMove = isInitMove && valid_solution;
+
     if (!valid_solution && !isInitMove) {  // Fall back to other solvers
         for (int soltype = 0; soltype < 4; soltype++) {
 
@@ -5265,6 +5276,7 @@ int Sketch::initMove(const std::vector<GeoElementId>& geoEltIds, bool fine)
 
     GCSsys.initSolution();
     isInitMove = true;
+    isWarmMove = false;
 
     return 0;
 }
@@ -5278,6 +5290,7 @@ int Sketch::initMove(int geoId, PointPos pos, bool fine)
 void Sketch::resetInitMove()
 {
     isInitMove = false;
+    isWarmMove = false;
 }
 
 int Sketch::initBSplinePieceMove(int geoId, PointPos pos, const Base::Vector3d& firstPoint, bool fine)
@@ -5342,6 +5355,7 @@ int Sketch::initBSplinePieceMove(int geoId, PointPos pos, const Base::Vector3d&
 
     GCSsys.initSolution();
     isInitMove = true;
+    isWarmMove = false;
     return 0;
 }
 
@@ -156,6 +156,17 @@ public:
         return MalformedConstraints;
     }
 
+    /// whether the last setUpSketch() reused the diagnosis of a structurally identical sketch
+    inline bool hasCachedDiagnosis() const
+    {
+        return GCSsys.isDiagnosisCached();
+    }
+    /// forces the next setUpSketch() to run a full diagnosis
+    inline void clearDiagnosisCache()
+    {
+        GCSsys.clearDiagnosisCache();
+    }
+
 public:
     std::set<std::pair<int, Sketcher::PointPos>> getDependencyGroup(int geoId, PointPos pos) const;
 
@@ -632,6 +643,8 @@ private:
     std::vector<GCS::BSpline> BSplines;
 
     bool isInitMove;
+    // the last drag step was solved successfully, so the next one can start from it
+    bool isWarmMove;
     bool isFine;
     Base::Vector3d initToPoint;
     double moveStep;
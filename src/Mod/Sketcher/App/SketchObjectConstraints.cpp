@@ -129,6 +129,12 @@ int SketchObject::solve(bool updateGeoAfterSolving /*=true*/)
     }
     else {
         lastSolverStatus = solvedSketch.solve();
+        if (lastSolverStatus != 0 && solvedSketch.hasCachedDiagnosis()) {
+            // The reused diagnosis may not hold for the new values (e.g. a dimension
+            // making two elements coincide), so diagnose the sketch from scratch.
+            solvedSketch.clearDiagnosisCache();
+            return solve(updateGeoAfterSolving);
+        }
         if (lastSolverStatus != 0) {// solving
             err = -1;
         }
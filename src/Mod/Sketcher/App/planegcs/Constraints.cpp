@@ -102,6 +102,37 @@ int Constraint::findParamInPvec(double* param)
     return ret;
 }
 
+void Constraint::grads(double* derivs)
+{
+    for (std::size_t i = 0; i < pvec.size(); i++) {
+        derivs[i] = grad(pvec[i]);
+    }
+}
+
+void Constraint::accumulateGrads(double* derivs)
+{
+    const std::size_t n = pvec.size();
+    // sum the partial derivatives into the first occurrence of each parameter
+    for (std::size_t i = 1; i < n; i++) {
+        for (std::size_t j = 0; j < i; j++) {
+            if (pvec[i] == pvec[j]) {
+                derivs[j] += derivs[i];
+                break;
+            }
+        }
+    }
+    // and copy the total derivative back to the other occurrences
+    for (std::size_t i = 0; i < n; i++) {
+        derivs[i] *= scale;
+        for (std::size_t j = 0; j < i; j++) {
+            if (pvec[i] == pvec[j]) {
+                derivs[i] = derivs[j];
+                break;
+            }
+        }
+    }
+}
+
 
 // --------------------------------------------------------
 // Equal
@@ -135,6 +166,13 @@ double ConstraintEqual::grad(double* param)
     }
     return scale * deriv;
 }
+
+void ConstraintEqual::grads(double* derivs)
+{
+    derivs[0] = 1;
+    derivs[1] = -1;
+    accumulateGrads(derivs);
+}
 void ConstraintEqual::evaluate()
 {
     *param2() = *param1() / ratio;
@@ -665,6 +703,14 @@ double ConstraintDifference::grad(double* param)
     }
     return scale * deriv;
 }
+
+void ConstraintDifference::grads(double* derivs)
+{
+    derivs[0] = -1;
+    derivs[1] = 1;
+    derivs[2] = -1;
+    accumulateGrads(derivs);
+}
 void ConstraintDifference::evaluate()
 {
     *difference() = scale * value();
@@ -727,6 +773,19 @@ double ConstraintP2PDistance::grad(double* param)
     return scale * deriv;
 }
 
+void ConstraintP2PDistance::grads(double* derivs)
+{
+    double dx = (*p1x() - *p2x());
+    double dy = (*p1y() - *p2y());
+    double d = sqrt(dx * dx + dy * dy);
+    derivs[0] = dx / d;
+    derivs[1] = dy / d;
+    derivs[2] = -dx / d;
+    derivs[3] = -dy / d;
+    derivs[4] = -1.;
+    accumulateGrads(derivs);
+}
+
 double ConstraintP2PDistance::maxStep(MAP_pD_D& dir, double lim)
 {
     MAP_pD_D::iterator it;
@@ -936,6 +995,30 @@ double ConstraintP2LDistance::grad(double* param)
     return scale * deriv;
 }
 
+void ConstraintP2LDistance::grads(double* derivs)
+{
+    double x0 = *p0x(), x1 = *p1x(), x2 = *p2x();
+    double y0 = *p0y(), y1 = *p1y(), y2 = *p2y();
+    double dx = x2 - x1;
+    double dy = y2 - y1;
+    double d2 = dx * dx + dy * dy;
+    double d = sqrt(d2);
+    double area = -x0 * dy + y0 * dx + x1 * y2 - x2 * y1;
+    derivs[0] = (y1 - y2) / d;
+    derivs[1] = (x2 - x1) / d;
+    derivs[2] = ((y2 - y0) * d + (dx / d) * area) / d2;
+    derivs[3] = ((x0 - x2) * d + (dy / d) * area) / d2;
+    derivs[4] = ((y0 - y1) * d - (dx / d) * area) / d2;
+    derivs[5] = ((x1 - x0) * d - (dy / d) * area) / d2;
+    if (area < 0) {
+        for (int i = 0; i < 6; i++) {
+            derivs[i] *= -1;
+        }
+    }
+    derivs[6] = -1;
+    accumulateGrads(derivs);
+}
+
 double ConstraintP2LDistance::maxStep(MAP_pD_D& dir, double lim)
 {
     MAP_pD_D::iterator it;
@@ -1070,6 +1153,24 @@ double ConstraintPointOnLine::grad(double* param)
     return scale * deriv;
 }
 
+void ConstraintPointOnLine::grads(double* derivs)
+{
+    double x0 = *p0x(), x1 = *p1x(), x2 = *p2x();
+    double y0 = *p0y(), y1 = *p1y(), y2 = *p2y();
+    double dx = x2 - x1;
+    double dy = y2 - y1;
+    double d2 = dx * dx + dy * dy;
+    double d = sqrt(d2);
+    double area = -x0 * dy + y0 * dx + x1 * y2 - x2 * y1;
+    derivs[0] = (y1 - y2) / d;
+    derivs[1] = (x2 - x1) / d;
+    derivs[2] = ((y2 - y0) * d + (dx / d) * area) / d2;
+    derivs[3] = ((x0 - x2) * d + (dy / d) * area) / d2;
+    derivs[4] = ((y0 - y1) * d - (dx / d) * area) / d2;
+    derivs[5] = ((x1 - x0) * d - (dy / d) * area) / d2;
+    accumulateGrads(derivs);
+}
+
 
 // --------------------------------------------------------
 // PointOnPerpBisector
@@ -1198,6 +1299,23 @@ double ConstraintParallel::grad(double* param)
     return scale * deriv;
 }
 
+void ConstraintParallel::grads(double* derivs)
+{
+    double dx1 = (*l1p1x() - *l1p2x());
+    double dy1 = (*l1p1y() - *l1p2y());
+    double dx2 = (*l2p1x() - *l2p2x());
+    double dy2 = (*l2p1y() - *l2p2y());
+    derivs[0] = dy2;
+    derivs[1] = -dx2;
+    derivs[2] = -dy2;
+    derivs[3] = dx2;
+    derivs[4] = -dy1;
+    derivs[5] = dx1;
+    derivs[6] = dy1;
+    derivs[7] = -dx1;
+    accumulateGrads(derivs);
+}
+
 
 // --------------------------------------------------------
 // Perpendicular
@@ -1298,6 +1416,23 @@ double ConstraintPerpendicular::grad(double* param)
     return scale * deriv;
 }
 
+void ConstraintPerpendicular::grads(double* derivs)
+{
+    double dx1 = (*l1p1x() - *l1p2x());
+    double dy1 = (*l1p1y() - *l1p2y());
+    double dx2 = (*l2p1x() - *l2p2x());
+    double dy2 = (*l2p1y() - *l2p2y());
+    derivs[0] = dx2;
+    derivs[1] = dy2;
+    derivs[2] = -dx2;
+    derivs[3] = -dy2;
+    derivs[4] = dx1;
+    derivs[5] = dy1;
+    derivs[6] = -dx1;
+    derivs[7] = -dy1;
+    accumulateGrads(derivs);
+}
+
 
 // --------------------------------------------------------
 // L2LAngle
@@ -1403,6 +1538,34 @@ double ConstraintL2LAngle::grad(double* param)
     return scale * deriv;
 }
 
+void ConstraintL2LAngle::grads(double* derivs)
+{
+    double dx1 = (*l1p2x() - *l1p1x());
+    double dy1 = (*l1p2y() - *l1p1y());
+    double r1 = dx1 * dx1 + dy1 * dy1;
+    derivs[0] = -dy1 / r1;
+    derivs[1] = dx1 / r1;
+    derivs[2] = dy1 / r1;
+    derivs[3] = -dx1 / r1;
+
+    double dx2 = (*l2p2x() - *l2p1x());
+    double dy2 = (*l2p2y() - *l2p1y());
+    double a = atan2(dy1, dx1) + *angle();
+    double ca = cos(a);
+    double sa = sin(a);
+    double x2 = dx2 * ca + dy2 * sa;
+    double y2 = -dx2 * sa + dy2 * ca;
+    double r2 = dx2 * dx2 + dy2 * dy2;
+    dx2 = -y2 / r2;
+    dy2 = x2 / r2;
+    derivs[4] = (-ca * dx2 + sa * dy2);
+    derivs[5] = (-sa * dx2 - ca * dy2);
+    derivs[6] = (ca * dx2 - sa * dy2);
+    derivs[7] = (sa * dx2 + ca * dy2);
+    derivs[8] = -1;
+    accumulateGrads(derivs);
+}
+
 double ConstraintL2LAngle::maxStep(MAP_pD_D& dir, double lim)
 {
     constexpr double pi_18 = std::numbers::pi / 18;
@@ -1630,6 +1793,33 @@ double ConstraintTangentCircumf::grad(double* param)
     return scale * deriv;
 }
 
+void ConstraintTangentCircumf::grads(double* derivs)
+{
+    double dx = (*c1x() - *c2x());
+    double dy = (*c1y() - *c2y());
+    double d_sq = dx * dx + dy * dy;
+
+    // near-concentric circles use the 'r1 - r2 = 0' formulation, see grad()
+    if (d_sq < 1e-14) {
+        Constraint::grads(derivs);
+        return;
+    }
+
+    derivs[0] = 2 * dx;
+    derivs[1] = 2 * dy;
+    derivs[2] = 2 * -dx;
+    derivs[3] = 2 * -dy;
+    if (internal) {
+        derivs[4] = 2 * (*r2() - *r1());
+        derivs[5] = 2 * (*r1() - *r2());
+    }
+    else {
+        derivs[4] = -2 * (*r1() + *r2());
+        derivs[5] = -2 * (*r1() + *r2());
+    }
+    accumulateGrads(derivs);
+}
+
 
 // --------------------------------------------------------
 // ConstraintPointOnEllipse
@@ -200,7 +200,11 @@ public:
 
         return deriv * scale;
     };
-    // virtual void grad(MAP_pD_D &deriv);  --> TODO: vectorized grad version
+    // Vectorized gradient: evaluates the derivatives with respect to all the parameters of pvec
+    // at once, sharing the common subexpressions. derivs must hold pvec.size() values and
+    // derivs[i] receives grad(pvec[i]), i.e. parameters occurring several times in pvec all get
+    // the total derivative.
+    virtual void grads(double* derivs);
     virtual double maxStep(MAP_pD_D& dir, double lim = 1.);
 
     // Evaluates the value of the constraint and assigns it to
@@ -215,6 +219,12 @@ public:
     // on ellipse's b (radmin), but b will be included within the constraint anyway.
     // Returns -1 if not found.
     int findParamInPvec(double* param);
+
+protected:
+    // Turns the partial derivatives per pvec entry into the derivatives per parameter, by
+    // summing the entries of parameters occurring several times in pvec (e.g. after the
+    // redirection of equal parameters), and applies the scale.
+    void accumulateGrads(double* derivs);
 };
 
 // Equal
@@ -236,6 +246,7 @@ public:
     ConstraintType getTypeId() override;
     double error() override;
     double grad(double*) override;
+    void grads(double* derivs) override;
     void evaluate() override;
 };
 
@@ -418,6 +429,7 @@ public:
     ConstraintType getTypeId() override;
     double error() override;
     double grad(double*) override;
+    void grads(double* derivs) override;
     void evaluate() override;
 };
 
@@ -456,6 +468,7 @@ public:
     ConstraintType getTypeId() override;
     double error() override;
     double grad(double*) override;
+    void grads(double* derivs) override;
     double maxStep(MAP_pD_D& dir, double lim = 1.) override;
     void evaluate() override;
 };
@@ -542,6 +555,7 @@ public:
     ConstraintType getTypeId() override;
     double error() override;
     double grad(double*) override;
+    void grads(double* derivs) override;
     double maxStep(MAP_pD_D& dir, double lim = 1.) override;
     double abs(double darea);
     void evaluate() override;
@@ -586,6 +600,7 @@ public:
     ConstraintType getTypeId() override;
     double error() override;
     double grad(double*) override;
+    void grads(double* derivs) override;
 };
 
 // PointOnPerpBisector
@@ -674,6 +689,7 @@ public:
     void rescale(double coef = 1.) override;
     double error() override;
     double grad(double*) override;
+    void grads(double* derivs) override;
 };
 
 // Perpendicular
@@ -725,6 +741,7 @@ public:
     void rescale(double coef = 1.) override;
     double error() override;
     double grad(double*) override;
+    void grads(double* derivs) override;
 };
 
 // L2LAngle
@@ -778,6 +795,7 @@ public:
     ConstraintType getTypeId() override;
     double error() override;
     double grad(double*) override;
+    void grads(double* derivs) override;
     double maxStep(MAP_pD_D& dir, double lim = 1.) override;
     void evaluate() override;
 };
@@ -876,6 +894,7 @@ public:
     ConstraintType getTypeId() override;
     double error() override;
     double grad(double*) override;
+    void grads(double* derivs) override;
 };
 // PointOnEllipse
 class ConstraintPointOnEllipse: public Constraint
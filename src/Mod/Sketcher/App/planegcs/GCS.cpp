@@ -49,10 +49,14 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
 #include <future>
 #include <iostream>
 #include <limits>
 #include <numbers>
+#include <thread>
 
 #include "GCS.h"
 #include "qp_eq.h"
@@ -479,6 +483,8 @@ System::System()
     , hasDiagnosis(false)
     , isInit(false)
     , emptyDiagnoseMatrix(true)
+    , cachedDofs(0)
+    , diagnosisFromCache(false)
     , maxIter(100)
     , maxIterRedundant(100)
     , sketchSizeMultiplier(false)
@@ -503,6 +509,7 @@ System::System()
     , DL_tolgRedundant(1E-80)
     , DL_tolxRedundant(1E-80)
     , DL_tolfRedundant(1E-10)
+    , maxThreads(0)
 {
     // currently Eigen only supports multithreading for multiplications
     // There is no appreciable gain from using more threads
@@ -532,6 +539,7 @@ void System::clear()
     conflictingTags.clear();
     redundantTags.clear();
     partiallyRedundantTags.clear();
+    diagnosisFromCache = false;
 
     reference.clear();
     clearSubSystems();
@@ -544,6 +552,7 @@ void System::clear()
 void System::invalidatedDiagnosis()
 {
     hasDiagnosis = false;
+    diagnosisFromCache = false;
     pDependentParameters.clear();
     pDependentParametersGroups.clear();
 }
@@ -1893,24 +1902,100 @@ int System::solve(bool isFine, Algorithm alg, bool isRedundantsolving)
         return Failed;
     }
 
-    bool isReset = false;
-    // return success by default in order to permit coincidence constraints to be applied
-    // even if no other system has to be solved
-    int res = Success;
+    std::vector<int> clusters;
     for (int cid = 0; cid < int(subSystems.size()); cid++) {
-        if ((subSystems[cid] || subSystemsAux[cid]) && !isReset) {
-            resetToReference();
-            isReset = true;
+        if (subSystems[cid] || subSystemsAux[cid]) {
+            clusters.push_back(cid);
         }
+    }
+    if (!clusters.empty()) {
+        resetToReference();
+    }
+
+    return solveClusters(clusters, isFine, alg, isRedundantsolving);
+}
+
+int System::solveTemporary(bool isFine, Algorithm alg)
+{
+    if (!isInit) {
+        return Failed;
+    }
+
+    // Only the clusters holding temporary constraints (e.g. the ones dragging the
+    // geometry under the mouse) can have moved since the last solve. The parameters
+    // are not reset to the reference, so that the solver starts from the previous
+    // solution, which is usually only a few pixels away from the new one.
+    std::vector<int> clusters;
+    for (int cid = 0; cid < int(subSystemsAux.size()); cid++) {
+        if (subSystemsAux[cid]) {
+            clusters.push_back(cid);
+        }
+    }
+
+    return solveClusters(clusters, isFine, alg, false);
+}
+
+int System::solveClusters(
+    const std::vector<int>& clusters,
+    bool isFine,
+    Algorithm alg,
+    bool isRedundantsolving
+)
+{
+    int clusterParams = 0;
+    for (int cid : clusters) {
+        clusterParams += (subSystems[cid] ? subSystems[cid]->pSize() : 0)
+            + (subSystemsAux[cid] ? subSystemsAux[cid]->pSize() : 0);
+    }
+
+    // The clusters do not share any unknown, so they can be solved concurrently.
+    // Each one writes its own status, which are then reduced in cluster order.
+    std::vector<int> results(clusters.size(), Success);
+    auto solveCluster = [&](std::size_t index) {
+        int cid = clusters[index];
         if (subSystems[cid] && subSystemsAux[cid]) {
-            res = std::max(res, solve(subSystems[cid], subSystemsAux[cid], isFine, isRedundantsolving));
+            results[index] = solve(subSystems[cid], subSystemsAux[cid], isFine, isRedundantsolving);
         }
         else if (subSystems[cid]) {
-            res = std::max(res, solve(subSystems[cid], isFine, alg, isRedundantsolving));
+            results[index] = solve(subSystems[cid], isFine, alg, isRedundantsolving);
+        }
+        else {
+            results[index] = solve(subSystemsAux[cid], isFine, alg, isRedundantsolving);
         }
-        else if (subSystemsAux[cid]) {
-            res = std::max(res, solve(subSystemsAux[cid], isFine, alg, isRedundantsolving));
+    };
+
+    std::size_t numThreads = maxThreads > 0 ? maxThreads : std::thread::hardware_concurrency();
+    numThreads = std::min(numThreads, clusters.size());
+    // threads only pay off when there is enough work to share, and iteration level
+    // debugging output of several clusters must not be interleaved
+    constexpr int minParallelParams = 64;
+    if (clusterParams < minParallelParams || debugMode == IterationLevel) {
+        numThreads = 1;
+    }
+#ifdef _GCS_EXTRACT_SOLVER_SUBSYSTEM_
+    numThreads = 1;
+#endif
+
+    std::atomic<std::size_t> next {0};
+    auto worker = [&]() {
+        for (std::size_t index = next++; index < clusters.size(); index = next++) {
+            solveCluster(index);
         }
+    };
+    std::vector<std::future<void>> futures;
+    for (std::size_t i = 1; i < numThreads; i++) {
+        futures.push_back(std::async(std::launch::async, worker));
+    }
+    worker();
+    for (auto& fut : futures) {
+        fut.get();
+    }
+
+    // return success by default in order to permit coincidence constraints to be applied
+    // even if no other system has to be solved
+    int res = Success;
+    for (int result : results) {
+        res = std::max(res, result);
     }
     if (res == Success) {
         for (std::set<Constraint*>::const_iterator constr = redundant.begin();
@@ -2087,7 +2172,7 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 
     Eigen::VectorXd e(csize),
         e_new(csize);  // vector of all function errors (every constraint is one function)
-    Eigen::MatrixXd J(csize, xsize);  // Jacobi of the subsystem
+    Eigen::SparseMatrix<double> J(csize, xsize);  // Jacobi of the subsystem
     Eigen::MatrixXd A(xsize, xsize);
     Eigen::VectorXd x(xsize), h(xsize), x_new(xsize), g(xsize), diag_A(xsize);
 
@@ -2141,7 +2226,8 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
         // J^T J, J^T e
         subsys->calcJacobi(J);
 
-        A = J.transpose() * J;
+        // each constraint only depends on a few parameters, so J is very sparse
+        A = Eigen::MatrixXd(J.transpose() * J);
         g = J.transpose() * e;
 
         // Compute ||J^T e||_inf
@@ -2295,7 +2381,7 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
 
     Eigen::VectorXd x(xsize), x_new(xsize);
     Eigen::VectorXd fx(csize), fx_new(csize);
-    Eigen::MatrixXd Jx(csize, xsize), Jx_new(csize, xsize);
+    Eigen::SparseMatrix<double> Jx(csize, xsize), Jx_new(csize, xsize);
     Eigen::VectorXd g(xsize), h_sd(xsize), h_gn(xsize), h_dl(xsize);
 
     subsys->redirectParams();
@@ -2351,13 +2437,13 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
         // https://forum.kde.org/viewtopic.php?f=74&t=129439#p346104
         switch (dogLegGaussStep) {
             case FullPivLU:
-                h_gn = Jx.fullPivLu().solve(-fx);
+                h_gn = Eigen::MatrixXd(Jx).fullPivLu().solve(-fx);
                 break;
             case LeastNormFullPivLU:
-                h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).fullPivLu().solve(-fx);
+                h_gn = Jx.adjoint() * Eigen::MatrixXd(Jx * Jx.adjoint()).fullPivLu().solve(-fx);
                 break;
             case LeastNormLdlt:
-                h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).ldlt().solve(-fx);
+                h_gn = Jx.adjoint() * Eigen::MatrixXd(Jx * Jx.adjoint()).ldlt().solve(-fx);
                 break;
         }
 
@@ -4717,10 +4803,11 @@ void System::makeReducedJacobian(
 )
 {
     // construct specific parameter list for diagonose ignoring driven constraint parameters
+    SET_pD pdrivenset(pdrivenlist.begin(), pdrivenlist.end());
+    MAP_pD_I pdiagnoseindex;
     for (int j = 0; j < int(plist.size()); j++) {
-        auto result1 = std::ranges::find(pdrivenlist, plist[j]);
-
-        if (result1 == std::end(pdrivenlist)) {
+        if (pdrivenset.find(plist[j]) == pdrivenset.end()) {
+            pdiagnoseindex[plist[j]] = static_cast<int>(pdiagnoselist.size());
             pdiagnoselist.push_back(plist[j]);
         }
     }
@@ -4730,13 +4817,21 @@ void System::makeReducedJacobian(
 
     int jacobianconstraintcount = 0;
     int allcount = 0;
+    VEC_D derivs;
     for (auto& constr : clist) {
         constr->revertParams();
         ++allcount;
         if (constr->getTag() >= 0 && constr->isDriving()) {
             jacobianconstraintcount++;
-            for (int j = 0; j < int(pdiagnoselist.size()); j++) {
-                J(jacobianconstraintcount - 1, j) = constr->grad(pdiagnoselist[j]);
+            // only the parameters of the constraint can have a non-zero derivative
+            const VEC_pD& cparams = c2p[constr];
+            derivs.resize(cparams.size());
+            constr->grads(derivs.data());
+            for (std::size_t k = 0; k < cparams.size(); k++) {
+                auto index = pdiagnoseindex.find(cparams[k]);
+                if (index != pdiagnoseindex.end()) {
+                    J(jacobianconstraintcount - 1, index->second) = derivs[k];
+                }
             }
 
             // parallel processing: create tag multiplicity map
@@ -4901,6 +4996,21 @@ int System::diagnose(Algorithm alg)
     // From here on, presuming `J.rows() > 0`.
     emptyDiagnoseMatrix = false;
 
+    // The structure doesn't determine the rank on its own, particular values can make the
+    // Jacobian singular. So a stored diagnosis is only reused if the rank is unchanged, which
+    // still costs the decomposition giving the rank but saves the one identifying the dependent
+    // parameters.
+    std::vector<std::int64_t> signature;
+    makeDiagnosisSignature(signature);
+    if (!diagnosisSignature.empty() && signature == diagnosisSignature) {
+        int paramsNum = 0;
+        int constrNum = 0;
+        int rank = diagnosisRank(J, jacobianconstraintmap, paramsNum, constrNum);
+        if (constrNum == rank && paramsNum - rank == cachedDofs && restoreDiagnosis(signature)) {
+            return dofs;
+        }
+    }
+
     if (qrAlgorithm == EigenDenseQR) {
 #ifdef PROFILE_DIAGNOSE
         Base::TimeElapsed DenseQR_start_time;
@@ -5056,9 +5166,125 @@ int System::diagnose(Algorithm alg)
     }
 #endif
 
+    storeDiagnosis(signature);
+
     return dofs;
 }
 
+void System::makeDiagnosisSignature(std::vector<std::int64_t>& signature)
+{
+    // Everything the structure of the reduced Jacobian and its QR analysis depend on:
+    // the unknowns, the driven parameters, the diagnosis settings and, for every
+    // constraint, its type, tag, drivingness and the unknowns it acts on.
+    auto paramIndex = [this](double* param) -> std::int64_t {
+        auto it = pIndex.find(param);
+        return it != pIndex.end() ? it->second : -1;
+    };
+
+    signature.clear();
+    signature.push_back(static_cast<std::int64_t>(plist.size()));
+    signature.push_back(autoChooseAlgorithm ? -1 : static_cast<std::int64_t>(qrAlgorithm));
+    signature.push_back(autoQRThreshold);
+    signature.push_back(std::bit_cast<std::int64_t>(qrpivotThreshold));
+    signature.push_back(static_cast<std::int64_t>(pdrivenlist.size()));
+    for (auto param : pdrivenlist) {
+        signature.push_back(paramIndex(param));
+    }
+    for (auto constr : clist) {
+        const VEC_pD& cparams = c2p[constr];
+        signature.push_back(static_cast<std::int64_t>(constr->getTypeId()));
+        signature.push_back(constr->getTag());
+        signature.push_back(constr->isDriving() ? 1 : 0);
+        signature.push_back(static_cast<std::int64_t>(constr->isInternalAlignment()));
+        signature.push_back(static_cast<std::int64_t>(cparams.size()));
+        for (auto param : cparams) {
+            signature.push_back(paramIndex(param));
+        }
+    }
+}
+
+bool System::restoreDiagnosis(const std::vector<std::int64_t>& signature)
+{
+    diagnosisFromCache = false;
+    if (diagnosisSignature.empty() || signature != diagnosisSignature) {
+        return false;
+    }
+
+    pDependentParameters.clear();
+    for (int index : cachedDependentParameters) {
+        pDependentParameters.push_back(plist[index]);
+    }
+    pDependentParametersGroups.clear();
+    for (const auto& group : cachedDependentParametersGroups) {
+        auto& paramGroup = pDependentParametersGroups.emplace_back();
+        for (int index : group) {
+            paramGroup.push_back(plist[index]);
+        }
+    }
+    dofs = cachedDofs;
+    emptyDiagnoseMatrix = false;
+    hasDiagnosis = true;
+    diagnosisFromCache = true;
+    return true;
+}
+
+int System::diagnosisRank(
+    const Eigen::MatrixXd& J,
+    const std::map<int, int>& jacobianconstraintmap,
+    int& paramsNum,
+    int& constrNum
+)
+{
+    int rank = 0;
+    Eigen::MatrixXd R;
+#ifdef EIGEN_SPARSEQR_COMPATIBLE
+    if (qrAlgorithm == EigenSparseQR) {
+        Eigen::SparseQR<Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int>> SqrJT;
+        makeSparseQRDecomposition(J, jacobianconstraintmap, SqrJT, rank, R, true, true);
+        paramsNum = SqrJT.rows();
+        constrNum = SqrJT.cols();
+        return rank;
+    }
+#endif
+    Eigen::FullPivHouseholderQR<Eigen::MatrixXd> qrJT;
+    makeDenseQRDecomposition(J, jacobianconstraintmap, qrJT, rank, R, true, true);
+    paramsNum = qrJT.rows();
+    constrNum = qrJT.cols();
+    return rank;
+}
+
+void System::storeDiagnosis(const std::vector<std::int64_t>& signature)
+{
+    // Whether dependent constraints are redundant or conflicting depends on their values,
+    // so only diagnoses without any of them can be reused for other values.
+    if (!redundant.empty() || !conflictingTags.empty() || !redundantTags.empty()
+        || !partiallyRedundantTags.empty()) {
+        diagnosisSignature.clear();
+        return;
+    }
+
+    diagnosisSignature = signature;
+    cachedDofs = dofs;
+    cachedDependentParameters.clear();
+    for (auto param : pDependentParameters) {
+        cachedDependentParameters.push_back(pIndex.at(param));
+    }
+    cachedDependentParametersGroups.clear();
+    for (const auto& group : pDependentParametersGroups) {
+        auto& indexGroup = cachedDependentParametersGroups.emplace_back();
+        for (auto param : group) {
+            indexGroup.push_back(pIndex.at(param));
+        }
+    }
+}
+
+void System::clearDiagnosisCache()
+{
+    diagnosisSignature.clear();
+    cachedDependentParameters.clear();
+    cachedDependentParametersGroups.clear();
+}
+
 void System::makeDenseQRDecomposition(
     const Eigen::MatrixXd& J,
     const std::map<int, int>& jacobianconstraintmap,
@@ -24,6 +24,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include <Eigen/QR>
 
 #include "../../SketcherGlobal.h"
@@ -145,9 +147,35 @@ private:
 
     bool emptyDiagnoseMatrix;  // false only if there is at least one driving constraint.
 
+    // The last diagnosis without conflicting or redundant constraints, in terms of parameter
+    // indices. It survives clear(), so that a system rebuilt with the same structure and rank,
+    // e.g. after changing a dimension, skips identifying the dependent parameters.
+    std::vector<std::int64_t> diagnosisSignature;
+    std::vector<int> cachedDependentParameters;
+    std::vector<std::vector<int>> cachedDependentParametersGroups;
+    int cachedDofs;
+    bool diagnosisFromCache;  // if the current diagnosis was restored from the cache
+
+    void makeDiagnosisSignature(std::vector<std::int64_t>& signature);
+    bool restoreDiagnosis(const std::vector<std::int64_t>& signature);
+    void storeDiagnosis(const std::vector<std::int64_t>& signature);
+    // the rank of the reduced Jacobian, as computed by the QR decomposition diagnose() uses
+    int diagnosisRank(
+        const Eigen::MatrixXd& J,
+        const std::map<int, int>& jacobianconstraintmap,
+        int& paramsNum,
+        int& constrNum
+    );
+
     int solve_BFGS(SubSystem* subsys, bool isFine = true, bool isRedundantsolving = false);
     int solve_LM(SubSystem* subsys, bool isRedundantsolving = false);
     int solve_DL(SubSystem* subsys, bool isRedundantsolving = false);
+    int solveClusters(
+        const std::vector<int>& clusters,
+        bool isFine,
+        Algorithm alg,
+        bool isRedundantsolving
+    );
 
     void makeReducedJacobian(
         Eigen::MatrixXd& J,
@@ -256,6 +284,9 @@ public:
     double DL_tolgRedundant;
     double DL_tolxRedundant;
     double DL_tolfRedundant;
+    // number of threads solving independent subsystems concurrently,
+    // 0 uses the hardware concurrency and 1 solves them serially
+    int maxThreads;
 
 public:
     System();
@@ -595,6 +626,10 @@ public:
         bool isRedundantsolving = false
     );
     int solve(SubSystem* subsysA, SubSystem* subsysB, bool isFine = true, bool isRedundantsolving = false);
+    // Re-solves only the clusters holding temporary constraints, starting from the
+    // current parameter values instead of the reference. Meant for successive solves
+    // of a drag operation after a regular solve of the same initialized system.
+    int solveTemporary(bool isFine = true, Algorithm alg = DogLeg);
 
     void applySolution();
     void evaluateDrivenConstraints();
@@ -655,6 +690,14 @@ public:
 
     void invalidatedDiagnosis();
 
+    // A diagnosis restored from the cache may miss singularities caused by particular
+    // values, so callers should clear the cache and diagnose again if the solver fails.
+    bool isDiagnosisCached() const
+    {
+        return diagnosisFromCache;
+    }
+    void clearDiagnosisCache();
+
     // Unit testing interface - not intended for use by production code
 protected:
     size_t _getNumberOfConstraints(int tagID = -1)
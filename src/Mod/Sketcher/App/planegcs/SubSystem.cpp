@@ -26,6 +26,7 @@
 # pragma warning(disable : 4251)
 #endif
 
+#include <algorithm>
 #include <iostream>
 #include <iterator>
 
@@ -114,21 +115,30 @@ void SubSystem::initialize(VEC_pD& params, MAP_pD_pD& reductionmap)
 
     c2p.clear();
     p2c.clear();
+    c2i.clear();
+    c2i.reserve(csize);
+    c2s.clear();
+    c2s.reserve(csize);
+    maxslots = 0;
     for (std::vector<Constraint*>::iterator constr = clist.begin(); constr != clist.end(); ++constr) {
         (*constr)->revertParams();  // ensure that the constraint points to the original parameters
         VEC_pD constr_params_orig = (*constr)->params();
-        SET_pD constr_params;
-        for (VEC_pD::const_iterator p = constr_params_orig.begin(); p != constr_params_orig.end();
-             ++p) {
-            MAP_pD_pD::const_iterator pmapfind = pmap.find(*p);
+        std::map<double*, int> constr_params;  // redirected parameter -> first params() slot
+        for (int slot = 0; slot < int(constr_params_orig.size()); slot++) {
+            MAP_pD_pD::const_iterator pmapfind = pmap.find(constr_params_orig[slot]);
             if (pmapfind != pmap.end()) {
-                constr_params.insert(pmapfind->second);
+                constr_params.emplace(pmapfind->second, slot);
             }
         }
-        for (SET_pD::const_iterator p = constr_params.begin(); p != constr_params.end(); ++p) {
+        maxslots = std::max(maxslots, constr_params_orig.size());
+        std::vector<int>& indices = c2i.emplace_back();
+        std::vector<int>& slots = c2s.emplace_back();
+        for (const auto& [p, slot] : constr_params) {
             //            jacobi.set(*constr, *p, 0.);
-            c2p[*constr].push_back(*p);
-            p2c[*p].push_back(*constr);
+            c2p[*constr].push_back(p);
+            p2c[p].push_back(*constr);
+            indices.push_back(static_cast<int>(p - pvals.data()));
+            slots.push_back(slot);
         }
         //        (*constr)->redirectParams(pmap); // redirect parameters to pvec
     }
@@ -254,11 +264,23 @@ void SubSystem::calcResidual(Eigen::VectorXd& r, double& err)
 void SubSystem::calcJacobi(VEC_pD& params, Eigen::MatrixXd& jacobi)
 {
     jacobi.setZero(csize, params.size());
+
+    // columns of the requested parameters, several parameters may be reduced to the same pvals entry
+    std::vector<std::vector<int>> columns(psize);
     for (int j = 0; j < int(params.size()); j++) {
         MAP_pD_pD::const_iterator pmapfind = pmap.find(params[j]);
         if (pmapfind != pmap.end()) {
-            for (int i = 0; i < csize; i++) {
-                jacobi(i, j) = clist[i]->grad(pmapfind->second);
+            columns[pmapfind->second - pvals.data()].push_back(j);
+        }
+    }
+
+    // only the parameters a constraint depends on can have a non-zero derivative
+    std::vector<double> derivs(maxslots);
+    for (int i = 0; i < csize; i++) {
+        clist[i]->grads(derivs.data());
+        for (std::size_t n = 0; n < c2i[i].size(); n++) {
+            for (int j : columns[c2i[i][n]]) {
+                jacobi(i, j) = derivs[c2s[i][n]];
             }
         }
     }
@@ -266,7 +288,30 @@ void SubSystem::calcJacobi(VEC_pD& params, Eigen::MatrixXd& jacobi)
 
 void SubSystem::calcJacobi(Eigen::MatrixXd& jacobi)
 {
-    calcJacobi(plist, jacobi);
+    jacobi.setZero(csize, psize);
+    std::vector<double> derivs(maxslots);
+    for (int i = 0; i < csize; i++) {
+        clist[i]->grads(derivs.data());
+        for (std::size_t n = 0; n < c2i[i].size(); n++) {
+            jacobi(i, c2i[i][n]) = derivs[c2s[i][n]];
+        }
+    }
+}
+
+void SubSystem::calcJacobi(Eigen::SparseMatrix<double>& jacobi)
+{
+    std::vector<Eigen::Triplet<double>> triplets;
+    std::vector<double> derivs(maxslots);
+    for (int i = 0; i < csize; i++) {
+        clist[i]->grads(derivs.data());
+        for (std::size_t n = 0; n < c2i[i].size(); n++) {
+            triplets.emplace_back(i, c2i[i][n], derivs[c2s[i][n]]);
+        }
+    }
+
+    jacobi.resize(csize, psize);
+    jacobi.setFromTriplets(triplets.begin(), triplets.end());
+    jacobi.makeCompressed();
 }
 
 void SubSystem::calcGrad(VEC_pD& params, Eigen::VectorXd& grad)
@@ -289,7 +334,18 @@ void SubSystem::calcGrad(VEC_pD& params, Eigen::VectorXd& grad)
 
 void SubSystem::calcGrad(Eigen::VectorXd& grad)
 {
-    calcGrad(plist, grad);
+    assert(grad.size() == psize);
+
+    // evaluate each residual once instead of once per parameter
+    grad.setZero();
+    std::vector<double> derivs(maxslots);
+    for (int i = 0; i < csize; i++) {
+        double err = clist[i]->error();
+        clist[i]->grads(derivs.data());
+        for (std::size_t n = 0; n < c2i[i].size(); n++) {
+            grad[c2i[i][n]] += err * derivs[c2s[i][n]];
+        }
+    }
 }
 
 double SubSystem::maxStep(VEC_pD& params, Eigen::VectorXd& xdir)
@@ -307,86 +307,64 @@ void Cell::setContent(const char* value)
                 setParseException(e.what());
             }
         }
-        else if (*value == '\'') {
-            if (value[1] == '\0') {
-                value = nullptr;
-            }
-            else {
-                newExpr = std::make_unique<App::StringExpression>(sheet, value + 1);
-            }
-        }
-        else if (*value != '\0') {
-            // check if value is just a number
-            char* end;
-            errno = 0;
-            const double float_value = strtod(value, &end);
-            if (errno == 0) {
-                const bool isEndEmpty = *end == '\0' || strspn(end, " \t\n\r") == strlen(end);
-                if (isEndEmpty) {
-                    newExpr = std::make_unique<App::NumberExpression>(sheet, Quantity(float_value));
-                }
-            }
-
-            // if not a float, check if it is a quantity or compatible fraction
-            const bool isStartingWithNumber = value != end;
-            if (!newExpr && isStartingWithNumber) {
-                try {
-                    ExpressionPtr parsedExpr(App::ExpressionParser::parse(sheet, value));
-
-                    if (const auto fraction = freecad_cast<OperatorExpression*>(parsedExpr.get())) {
-                        if (fraction->getOperator() == OperatorExpression::UNIT) {
-                            const auto left = freecad_cast<NumberExpression*>(fraction->getLeft());
-                            const auto right = freecad_cast<UnitExpression*>(fraction->getRight());
-                            if (left && right) {
-                                newExpr = std::move(parsedExpr);
-                            }
-                        }
-                        else if (fraction->getOperator() == OperatorExpression::DIV) {
-                            // only the following types of fractions are ok:
-                            //     1/2, 1m/2, 1/2s, 1m/2s, 1/m
-
-                            // check for numbers in (de)nominator
-                            const bool isNumberNom = freecad_cast<NumberExpression*>(
-                                fraction->getLeft()
-                            );
-                            const bool isNumberDenom = freecad_cast<NumberExpression*>(
-                                fraction->getRight()
-                            );
-
-                            // check for numbers with units in (de)nominator
-                            const auto opNom = freecad_cast<OperatorExpression*>(fraction->getLeft());
-                            const auto opDenom = freecad_cast<OperatorExpression*>(
-                                fraction->getRight()
-                            );
-                            const bool isQuantityNom = opNom
-                                && opNom->getOperator() == OperatorExpression::UNIT;
-                            const bool isQuantityDenom = opDenom
-                                && opDenom->getOperator() == OperatorExpression::UNIT;
-
-                            // check for units in denomainator
-                            const auto uDenom = freecad_cast<UnitExpression*>(fraction->getRight());
-                            const bool isUnitDenom = uDenom && uDenom->is<UnitExpression>();
-
-                            const bool isNomValid = isNumberNom || isQuantityNom;
-                            const bool isDenomValid = isNumberDenom || isQuantityDenom || isUnitDenom;
-                            if (isNomValid && isDenomValid) {
-                                newExpr = std::move(parsedExpr);
-                            }
+        else if (!parseLiteral(sheet, value, newExpr)) {
+            // not a plain number, check if it is a quantity or compatible fraction
+            try {
+                ExpressionPtr parsedExpr(App::ExpressionParser::parse(sheet, value));
+
+                if (const auto fraction = freecad_cast<OperatorExpression*>(parsedExpr.get())) {
+                    if (fraction->getOperator() == OperatorExpression::UNIT) {
+                        const auto left = freecad_cast<NumberExpression*>(fraction->getLeft());
+                        const auto right = freecad_cast<UnitExpression*>(fraction->getRight());
+                        if (left && right) {
+                            newExpr = std::move(parsedExpr);
                         }
                     }
-                    else if (const auto number = freecad_cast<NumberExpression*>(parsedExpr.get())) {
-                        // NumbersExpressions can accept more than can be parsed with strtod.
-                        //   Example: 12.34 and 12,34 are both valid NumberExpressions
-                        newExpr = std::move(parsedExpr);
+                    else if (fraction->getOperator() == OperatorExpression::DIV) {
+                        // only the following types of fractions are ok:
+                        //     1/2, 1m/2, 1/2s, 1m/2s, 1/m
+
+                        // check for numbers in (de)nominator
+                        const bool isNumberNom = freecad_cast<NumberExpression*>(
+                            fraction->getLeft()
+                        );
+                        const bool isNumberDenom = freecad_cast<NumberExpression*>(
+                            fraction->getRight()
+                        );
+
+                        // check for numbers with units in (de)nominator
+                        const auto opNom = freecad_cast<OperatorExpression*>(fraction->getLeft());
+                        const auto opDenom = freecad_cast<OperatorExpression*>(
+                            fraction->getRight()
+                        );
+                        const bool isQuantityNom = opNom
+                            && opNom->getOperator() == OperatorExpression::UNIT;
+                        const bool isQuantityDenom = opDenom
+                            && opDenom->getOperator() == OperatorExpression::UNIT;
+
+                        // check for units in denomainator
+                        const auto uDenom = freecad_cast<UnitExpression*>(fraction->getRight());
+                        const bool isUnitDenom = uDenom && uDenom->is<UnitExpression>();
+
+                        const bool isNomValid = isNumberNom || isQuantityNom;
+                        const bool isDenomValid = isNumberDenom || isQuantityDenom || isUnitDenom;
+                        if (isNomValid && isDenomValid) {
+                            newExpr = std::move(parsedExpr);
+                        }
                     }
                 }
-                catch (...) {
+                else if (const auto number = freecad_cast<NumberExpression*>(parsedExpr.get())) {
+                    // NumbersExpressions can accept more than can be parsed with strtod.
+                    //   Example: 12.34 and 12,34 are both valid NumberExpressions
+                    newExpr = std::move(parsedExpr);
                 }
             }
-        }
+            catch (...) {
+            }
 
-        if (!newExpr && value && *value != '\0') {
-            newExpr = std::make_unique<App::StringExpression>(sheet, value);
+            if (!newExpr) {
+                newExpr = std::make_unique<App::StringExpression>(sheet, value);
+            }
         }
 
         // trying to add an empty string will make newExpr = nullptr
@@ -398,6 +376,59 @@ void Cell::setContent(const char* value)
     signaller.tryInvoke();
 }
 
+/**
+ * Parse \a value as a literal content, i.e. without the expression parser.
+ *
+ * Plain numbers and text are literals, as is anything quoted with a leading apostrophe. Formulas,
+ * and contents starting with a number that are not a plain number, e.g. quantities, are not.
+ * This does not modify any cell, so contents can be parsed concurrently, see
+ * Sheet::importFromFile().
+ *
+ * @param owner The owner of the expression.
+ * @param value The content.
+ * @param expr  Set to the expression of the literal, or 0 if the content is empty.
+ *
+ * @returns true if \a value is a literal.
+ *
+ */
+
+bool Cell::parseLiteral(const App::DocumentObject* owner, const char* value, ExpressionPtr& expr)
+{
+    expr.reset();
+    if (*value == '\0') {
+        return true;
+    }
+    if (*value == '=') {
+        return false;
+    }
+    if (*value == '\'') {
+        if (value[1] != '\0') {
+            expr = std::make_unique<App::StringExpression>(owner, value + 1);
+        }
+        return true;
+    }
+
+    // check if value is just a number
+    char* end;
+    errno = 0;
+    const double float_value = strtod(value, &end);
+    if (errno == 0) {
+        const bool isEndEmpty = *end == '\0' || strspn(end, " \t\n\r") == strlen(end);
+        if (isEndEmpty) {
+            expr = std::make_unique<App::NumberExpression>(owner, Quantity(float_value));
+            return true;
+        }
+    }
+
+    // a content starting with a number may be a quantity or a fraction
+    const bool isStartingWithNumber = value != end;
+    if (isStartingWithNumber) {
+        return false;
+    }
+    expr = std::make_unique<App::StringExpression>(owner, value);
+    return true;
+}
+
 /**
  * Set alignment of this cell. Alignment is the or'ed value of
  * vertical and horizontal alignment, given by the constants
@@ -629,6 +660,17 @@ bool Cell::getComputedUnit(Base::Unit& unit) const
     return isUsed(COMPUTED_UNIT_SET);
 }
 
+/**
+ * Set the value computed for the cell to \a value, i.e. the result of evaluating its content.
+ * The value is not copied with the cell, as copies are always recomputed.
+ *
+ */
+
+void Cell::setComputedValue(App::ExpressionPtr&& value)
+{
+    computedValue = std::move(value);
+}
+
 /**
  * Set the cell's row and column span to \a rows and \a columns. This
  * is done when cells are merged.
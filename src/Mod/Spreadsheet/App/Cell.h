@@ -69,6 +69,12 @@ public:
 
     void setContent(const char* value);
 
+    static bool parseLiteral(
+        const App::DocumentObject* owner,
+        const char* value,
+        App::ExpressionPtr& expr
+    );
+
     void setAlignment(int _alignment);
     bool getAlignment(int& _alignment) const;
 
@@ -90,6 +96,13 @@ public:
     void setComputedUnit(const Base::Unit& unit);
     bool getComputedUnit(Base::Unit& unit) const;
 
+    void setComputedValue(App::ExpressionPtr&& value);
+
+    const App::Expression* getComputedValue() const
+    {
+        return computedValue.get();
+    }
+
     void setSpans(int rows, int columns);
     bool getSpans(int& rows, int& columns) const;
 
@@ -206,6 +219,7 @@ private:
     DisplayUnit displayUnit;
     std::string alias;
     Base::Unit computedUnit;
+    App::ExpressionPtr computedValue;
     int rowSpan;
     int colSpan;
     std::string exceptionStr;
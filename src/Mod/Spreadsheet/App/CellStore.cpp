@@ -0,0 +1,211 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include <algorithm>
+
+#include "CellStore.h"
+
+
+using namespace Spreadsheet;
+
+std::size_t CellStore::lowerBound(const Block& block, App::CellAddress address)
+{
+    auto it = std::lower_bound(
+        block.begin(),
+        block.end(),
+        address,
+        [](const value_type& entry, const App::CellAddress& key) { return entry.first < key; }
+    );
+    return it - block.begin();
+}
+
+CellStore::iterator CellStore::find(App::CellAddress address)
+{
+    std::size_t block = blockOf(address);
+    if (block < blocks.size()) {
+        std::size_t index = lowerBound(blocks[block], address);
+        if (index < blocks[block].size() && blocks[block][index].first == address) {
+            return {this, block, index};
+        }
+    }
+    return end();
+}
+
+CellStore::const_iterator CellStore::find(App::CellAddress address) const
+{
+    return const_cast<CellStore*>(this)->find(address);  // NOLINT
+}
+
+Cell*& CellStore::operator[](App::CellAddress address)
+{
+    std::size_t block = blockOf(address);
+    if (block >= blocks.size()) {
+        blocks.resize(block + 1);
+    }
+    auto& entries = blocks[block];
+
+    // cells are mostly added in address order, e.g. when restoring a sheet
+    if (entries.empty() || entries.back().first < address) {
+        ++cellCount;
+        return entries.emplace_back(address, nullptr).second;
+    }
+
+    std::size_t index = lowerBound(entries, address);
+    if (entries[index].first != address) {
+        ++cellCount;
+        entries.emplace(entries.begin() + index, address, nullptr);
+    }
+    return entries[index].second;
+}
+
+CellStore::iterator CellStore::erase(const_iterator pos)
+{
+    auto& entries = blocks[pos.block];
+    entries.erase(entries.begin() + pos.index);
+    --cellCount;
+    return {this, pos.block, pos.index};
+}
+
+std::size_t CellStore::erase(App::CellAddress address)
+{
+    auto it = find(address);
+    if (it == end()) {
+        return 0;
+    }
+    erase(it);
+    return 1;
+}
+
+void CellStore::clear()
+{
+    blocks.clear();
+    cellCount = 0;
+}
+
+std::size_t CellStore::getMemSize() const
+{
+    std::size_t size = blocks.capacity() * sizeof(Block);
+    for (const auto& entries : blocks) {
+        size += entries.capacity() * sizeof(value_type);
+    }
+    return size;
+}
+
+
+int CellDependencyMap::intern(const std::string& name)
+{
+    auto res = nameIds.try_emplace(name, static_cast<int>(names.size()));
+    if (res.second) {
+        names.push_back(name);
+        cellsByName.emplace_back();
+    }
+    return res.first->second;
+}
+
+void CellDependencyMap::insert(App::CellAddress address, const std::string& name)
+{
+    int id = intern(name);
+    auto& edges = edgesByCell[keyOf(address)];
+    for (const auto& edge : edges) {
+        if (edge.name == id) {
+            return;
+        }
+    }
+    auto& cells = cellsByName[id];
+    edges.push_back({id, static_cast<int>(cells.size())});
+    cells.emplace_back(address.row(), address.col());
+}
+
+bool CellDependencyMap::erase(App::CellAddress address)
+{
+    auto it = edgesByCell.find(keyOf(address));
+    if (it == edgesByCell.end()) {
+        return false;
+    }
+
+    for (const auto& edge : it->second) {
+        auto& cells = cellsByName[edge.name];
+        App::CellAddress last = cells.back();
+        cells[edge.slot] = last;
+        cells.pop_back();
+        if (edge.slot == static_cast<int>(cells.size())) {
+            continue;
+        }
+        // the last cell took the place of the removed one, update its edge
+        auto moved = edgesByCell.find(keyOf(last));
+        for (auto& movedEdge : moved->second) {
+            if (movedEdge.name == edge.name) {
+                movedEdge.slot = edge.slot;
+                break;
+            }
+        }
+    }
+    edgesByCell.erase(it);
+    return true;
+}
+
+void CellDependencyMap::clear()
+{
+    nameIds.clear();
+    names.clear();
+    cellsByName.clear();
+    edgesByCell.clear();
+}
+
+const std::vector<App::CellAddress>& CellDependencyMap::getCells(const std::string& name) const
+{
+    static const std::vector<App::CellAddress> empty;
+    auto it = nameIds.find(name);
+    if (it == nameIds.end()) {
+        return empty;
+    }
+    return cellsByName[it->second];
+}
+
+std::set<std::string> CellDependencyMap::getNames(App::CellAddress address) const
+{
+    std::set<std::string> res;
+    auto it = edgesByCell.find(keyOf(address));
+    if (it != edgesByCell.end()) {
+        for (const auto& edge : it->second) {
+            res.insert(names[edge.name]);
+        }
+    }
+    return res;
+}
+
+std::size_t CellDependencyMap::getMemSize() const
+{
+    std::size_t size = 0;
+    for (const auto& name : names) {
+        // the name is stored twice, in names and as a key of nameIds
+        size += 2 * (sizeof(std::string) + name.capacity()) + sizeof(int);
+    }
+    for (const auto& cells : cellsByName) {
+        size += sizeof(cells) + cells.capacity() * sizeof(App::CellAddress);
+    }
+    for (const auto& entry : edgesByCell) {
+        size += sizeof(entry) + entry.second.capacity() * sizeof(Edge);
+    }
+    return size;
+}
@@ -0,0 +1,263 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <App/Range.h>
+
+#include <Mod/Spreadsheet/SpreadsheetGlobal.h>
+
+
+namespace Spreadsheet
+{
+
+class Cell;
+
+/*! Ordered storage of the cells of a PropertySheet.
+ *
+ * The cells are kept in blocks of consecutive rows. Each block is an array of (address, cell)
+ * pairs sorted by address, so a lookup is a direct block access plus a binary search, and
+ * iterating visits the cells in address order, like the std::map this replaces. Inserting or
+ * erasing a cell only moves the entries of its own block.
+ *
+ * Unlike with std::map, inserting or erasing a cell invalidates the iterators and references
+ * into the same block.
+ */
+class SpreadsheetExport CellStore
+{
+public:
+    using key_type = App::CellAddress;
+    using mapped_type = Cell*;
+    using value_type = std::pair<App::CellAddress, Cell*>;
+
+    template<typename Store, typename Value>
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = CellStore::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Value*;
+        using reference = Value&;
+
+        Iterator() = default;
+
+        Iterator(Store* store, std::size_t block, std::size_t index)
+            : store(store)
+            , block(block)
+            , index(index)
+        {
+            skipEmpty();
+        }
+
+        // iterator converts to const_iterator
+        template<typename OtherStore, typename OtherValue>
+        Iterator(const Iterator<OtherStore, OtherValue>& other)  // NOLINT
+            : store(other.store)
+            , block(other.block)
+            , index(other.index)
+        {}
+
+        reference operator*() const
+        {
+            return store->blocks[block][index];
+        }
+
+        pointer operator->() const
+        {
+            return &store->blocks[block][index];
+        }
+
+        Iterator& operator++()
+        {
+            ++index;
+            skipEmpty();
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        bool operator==(const Iterator& other) const
+        {
+            return block == other.block && index == other.index;
+        }
+
+        bool operator!=(const Iterator& other) const
+        {
+            return !(*this == other);
+        }
+
+    private:
+        void skipEmpty()
+        {
+            while (block < store->blocks.size() && index >= store->blocks[block].size()) {
+                ++block;
+                index = 0;
+            }
+        }
+
+        Store* store {nullptr};
+        std::size_t block {0};
+        std::size_t index {0};
+
+        template<typename, typename>
+        friend class Iterator;
+        friend class CellStore;
+    };
+
+    using iterator = Iterator<CellStore, value_type>;
+    using const_iterator = Iterator<const CellStore, const value_type>;
+
+    iterator begin()
+    {
+        return {this, 0, 0};
+    }
+
+    iterator end()
+    {
+        return {this, blocks.size(), 0};
+    }
+
+    const_iterator begin() const
+    {
+        return {this, 0, 0};
+    }
+
+    const_iterator end() const
+    {
+        return {this, blocks.size(), 0};
+    }
+
+    iterator find(App::CellAddress address);
+
+    const_iterator find(App::CellAddress address) const;
+
+    std::size_t count(App::CellAddress address) const
+    {
+        return find(address) != end() ? 1 : 0;
+    }
+
+    /// Returns the cell slot at \a address, inserting an empty one if there is none yet
+    Cell*& operator[](App::CellAddress address);
+
+    /// Erases the cell at \a pos and returns the iterator following it
+    iterator erase(const_iterator pos);
+
+    std::size_t erase(App::CellAddress address);
+
+    void clear();
+
+    std::size_t size() const
+    {
+        return cellCount;
+    }
+
+    bool empty() const
+    {
+        return cellCount == 0;
+    }
+
+    /// Approximate heap memory used by the store itself, i.e. excluding the cells
+    std::size_t getMemSize() const;
+
+private:
+    using Block = std::vector<value_type>;
+
+    // number of rows in a block, as a power of two
+    static constexpr int blockShift = 5;
+
+    static std::size_t blockOf(App::CellAddress address)
+    {
+        return address.row() > 0 ? static_cast<std::size_t>(address.row()) >> blockShift : 0;
+    }
+
+    // index of the first entry of \a block not before \a address
+    static std::size_t lowerBound(const Block& block, App::CellAddress address);
+
+    std::vector<Block> blocks;
+    std::size_t cellCount {0};
+};
+
+/*! Two-way index between cells and the names they depend on.
+ *
+ * PropertySheet uses it to find the cells to recompute when a property or an object changes,
+ * and to find what a cell depends on. The names are interned. Each cell keeps a short array of
+ * edges to the names it refers to, and each name an array of the cells referring to it. An
+ * edge also records the position of the cell in the array of the name, so adding or removing
+ * the dependencies of a cell costs the same however many cells share a name.
+ */
+class SpreadsheetExport CellDependencyMap
+{
+public:
+    /// Records that the cell at \a address depends on \a name
+    void insert(App::CellAddress address, const std::string& name);
+
+    /// Removes all dependencies of the cell at \a address, returns false if it had none
+    bool erase(App::CellAddress address);
+
+    void clear();
+
+    /// Returns the cells depending on \a name, in no particular order
+    const std::vector<App::CellAddress>& getCells(const std::string& name) const;
+
+    /// Returns the names the cell at \a address depends on
+    std::set<std::string> getNames(App::CellAddress address) const;
+
+    /// Approximate heap memory used by the index
+    std::size_t getMemSize() const;
+
+private:
+    struct Edge
+    {
+        int name;
+        int slot;  // position of the cell in cellsByName[name]
+    };
+
+    static unsigned int keyOf(App::CellAddress address)
+    {
+        return (static_cast<unsigned int>(address.row()) << 16)
+            | static_cast<unsigned short>(address.col());
+    }
+
+    int intern(const std::string& name);
+
+    std::unordered_map<std::string, int> nameIds;
+    std::vector<std::string> names;
+    std::vector<std::vector<App::CellAddress>> cellsByName;
+    std::unordered_map<unsigned int, std::vector<Edge>> edgesByCell;
+};
+
+}  // namespace Spreadsheet
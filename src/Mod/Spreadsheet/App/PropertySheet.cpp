@@ -68,10 +68,8 @@ void PropertySheet::clear()
 
     mergedCells.clear();
 
-    propertyNameToCellMap.clear();
-    cellToPropertyNameMap.clear();
-    documentObjectToCellMap.clear();
-    cellToDocumentObjectMap.clear();
+    propertyDeps.clear();
+    documentObjectDeps.clear();
     aliasProp.clear();
     revAliasProp.clear();
 
@@ -80,7 +78,7 @@ void PropertySheet::clear()
 
 Cell* PropertySheet::getValue(CellAddress key)
 {
-    std::map<CellAddress, Cell*>::const_iterator i = data.find(key);
+    auto i = data.find(key);
 
     if (i == data.end()) {
         return nullptr;
@@ -92,7 +90,7 @@ Cell* PropertySheet::getValue(CellAddress key)
 
 const Cell* PropertySheet::getValue(CellAddress key) const
 {
-    std::map<CellAddress, Cell*>::const_iterator i = data.find(key);
+    auto i = data.find(key);
 
     if (i == data.end()) {
         return nullptr;
@@ -281,22 +279,18 @@ PropertySheet::PropertySheet(Sheet* _owner)
 
 PropertySheet::PropertySheet(const PropertySheet& other)
     : dirty(other.dirty)
+    , data(other.data)
     , mergedCells(other.mergedCells)
     , owner(other.owner)
-    , propertyNameToCellMap(other.propertyNameToCellMap)
-    , cellToPropertyNameMap(other.cellToPropertyNameMap)
-    , documentObjectToCellMap(other.documentObjectToCellMap)
-    , cellToDocumentObjectMap(other.cellToDocumentObjectMap)
+    , propertyDeps(other.propertyDeps)
+    , documentObjectDeps(other.documentObjectDeps)
     , aliasProp(other.aliasProp)
     , revAliasProp(other.revAliasProp)
     , updateCount(other.updateCount)
 {
-    std::map<CellAddress, Cell*>::const_iterator i = other.data.begin();
-
-    /* Copy cells */
-    while (i != other.data.end()) {
-        data[i->first] = new Cell(this, *i->second);
-        ++i;
+    /* Copy cells, the store itself already has the same layout */
+    for (auto& i : data) {
+        i.second = new Cell(this, *i.second);
     }
 }
 
@@ -316,19 +310,16 @@ void PropertySheet::Paste(const Property& from)
 
     AtomicPropertyChange signaller(*this);
 
-    std::map<CellAddress, Cell*>::iterator icurr = data.begin();
-
     /* Mark all first */
-    while (icurr != data.end()) {
-        icurr->second->mark();
-        ++icurr;
+    for (auto& i : data) {
+        i.second->mark();
     }
 
-    std::map<CellAddress, Cell*>::const_iterator ifrom = froms.data.begin();
+    auto ifrom = froms.data.begin();
     std::vector<CellAddress> spanChanges;
     int rows, cols;
     while (ifrom != froms.data.end()) {
-        auto& cell = data[ifrom->first];
+        Cell* cell = getValue(ifrom->first);
 
         if (cell) {
             int r, c;
@@ -344,6 +335,7 @@ void PropertySheet::Paste(const Property& from)
                 this,
                 *(ifrom->second)
             );  // Doesn't exist, copy using Cell's copy constructor
+            data[ifrom->first] = cell;
             if (cell->getSpans(rows, cols)) {
                 spanChanges.push_back(ifrom->first);
             }
@@ -355,24 +347,21 @@ void PropertySheet::Paste(const Property& from)
         ++ifrom;
     }
 
-    /* Remove all that are still marked */
-    icurr = data.begin();
-    while (icurr != data.end()) {
-        Cell* cell = icurr->second;
+    /* Remove all that are still marked; clear() erases from the store, so collect them first */
+    std::vector<CellAddress> marked;
+    for (const auto& i : data) {
+        if (i.second->isMarked()) {
+            marked.push_back(i.first);
+        }
+    }
+    for (const auto& address : marked) {
+        Cell* cell = getValue(address);
 
-        if (cell->isMarked()) {
+        if (cell) {
             if (cell->getSpans(rows, cols)) {
-                spanChanges.push_back(icurr->first);
+                spanChanges.push_back(address);
             }
-
-            std::map<CellAddress, Cell*>::iterator next = icurr;
-
-            ++next;
-            clear(icurr->first);
-            icurr = next;
-        }
-        else {
-            ++icurr;
+            clear(address);
         }
     }
 
@@ -392,7 +381,7 @@ void PropertySheet::Save(Base::Writer& writer) const
     // Save cell contents
     int count = 0;
 
-    std::map<CellAddress, Cell*>::const_iterator ci = data.begin();
+    auto ci = data.begin();
     while (ci != data.end()) {
         if (ci->second->isUsed()) {
             ++count;
@@ -642,13 +631,13 @@ Cell* PropertySheet::cellAt(CellAddress address)
 
     // address actually inside a merged cell
     if (j != mergedCells.end()) {
-        std::map<CellAddress, Cell*>::const_iterator i = data.find(j->second);
+        auto i = data.find(j->second);
         assert(i != data.end());
 
         return i->second;
     }
 
-    std::map<CellAddress, Cell*>::const_iterator i = data.find(address);
+    auto i = data.find(address);
 
     if (i == data.end()) {
         return nullptr;
@@ -664,13 +653,13 @@ const Cell* PropertySheet::cellAt(CellAddress address) const
 
     // address actually inside a merged cell
     if (j != mergedCells.end()) {
-        std::map<CellAddress, Cell*>::const_iterator i = data.find(j->second);
+        auto i = data.find(j->second);
         assert(i != data.end());
 
         return i->second;
     }
 
-    std::map<CellAddress, Cell*>::const_iterator i = data.find(address);
+    auto i = data.find(address);
 
     if (i == data.end()) {
         return nullptr;
@@ -685,7 +674,7 @@ Cell* PropertySheet::nonNullCellAt(CellAddress address)
     std::map<CellAddress, CellAddress>::const_iterator j = mergedCells.find(address);
 
     if (j != mergedCells.end()) {
-        std::map<CellAddress, Cell*>::const_iterator i = data.find(j->second);
+        auto i = data.find(j->second);
 
         if (i == data.end()) {
             return createCell(address);
@@ -695,7 +684,7 @@ Cell* PropertySheet::nonNullCellAt(CellAddress address)
         }
     }
 
-    std::map<CellAddress, Cell*>::const_iterator i = data.find(address);
+    auto i = data.find(address);
 
     if (i == data.end()) {
         return createCell(address);
@@ -712,6 +701,30 @@ void PropertySheet::setContent(CellAddress address, const char* value)
     cell->setContent(value);
 }
 
+/**
+ * Set the content of many cells at once, e.g. when importing a file. The literal contents are
+ * already parsed, the others are parsed like by setContent(). The contents are moved from.
+ */
+
+void PropertySheet::setContents(std::vector<CellContent>& contents)
+{
+    AtomicPropertyChange signaller(*this);
+
+    for (auto& content : contents) {
+        Cell* cell = nonNullCellAt(content.address);
+        assert(cell);
+        if (content.isLiteral) {
+            cell->clearException();
+            cell->setExpression(std::move(content.literal));
+        }
+        else {
+            cell->setContent(content.text.c_str());
+        }
+    }
+
+    signaller.tryInvoke();
+}
+
 void PropertySheet::setAlignment(CellAddress address, int _alignment)
 {
     Cell* cell = nonNullCellAt(address);
@@ -775,16 +788,8 @@ void PropertySheet::setAlias(CellAddress address, const std::string& alias)
      * disappears */
     std::string fullName = owner->getFullName() + "." + address.toString();
 
-    std::map<std::string, std::set<CellAddress>>::const_iterator j = propertyNameToCellMap.find(
-        fullName
-    );
-    if (j != propertyNameToCellMap.end()) {
-        std::set<CellAddress>::const_iterator k = j->second.begin();
-
-        while (k != j->second.end()) {
-            setDirty(*k);
-            ++k;
-        }
+    for (const auto& k : propertyDeps.getCells(fullName)) {
+        setDirty(k);
     }
 
     std::string oldAlias;
@@ -832,9 +837,9 @@ void PropertySheet::clearAlias(CellAddress address)
 
 void PropertySheet::clear(CellAddress address, bool toClearAlias)
 {
-    std::map<CellAddress, Cell*>::iterator i = data.find(address);
+    Cell* cell = getValue(address);
 
-    if (i == data.end()) {
+    if (!cell) {
         return;
     }
 
@@ -845,17 +850,17 @@ void PropertySheet::clear(CellAddress address, bool toClearAlias)
 
     // Delete Cell object
     removeDependencies(address);
-    delete i->second;
+    delete cell;
 
     // Mark as dirty
-    dirty.insert(i->first);
+    dirty.insert(address);
 
     if (toClearAlias) {
         clearAlias(address);
     }
 
     // Erase from internal struct
-    data.erase(i);
+    data.erase(address);
     signaller.tryInvoke();
 }
 
@@ -875,18 +880,14 @@ void PropertySheet::moveCell(
     std::map<App::ObjectIdentifier, App::ObjectIdentifier>& renames
 )
 {
-    std::map<CellAddress, Cell*>::const_iterator i = data.find(currPos);
-    std::map<CellAddress, Cell*>::const_iterator j = data.find(newPos);
-
     AtomicPropertyChange signaller(*this);
 
-    if (j != data.end()) {
+    if (data.count(newPos)) {
         // do not clear alias because we have moved them already
         clear(newPos, false);
     }
 
-    if (i != data.end()) {
-        Cell* cell = i->second;
+    if (Cell* cell = getValue(currPos)) {
         int rows, columns;
 
         // Get merged cell data
@@ -943,7 +944,7 @@ void PropertySheet::insertRows(int row, int count)
     }
 
     for (std::vector<CellAddress>::const_reverse_iterator i = keys.rbegin(); i != keys.rend(); ++i) {
-        std::map<CellAddress, Cell*>::iterator j = data.find(*i);
+        auto j = data.find(*i);
 
         assert(j != data.end());
 
@@ -1025,7 +1026,7 @@ void PropertySheet::removeRows(int row, int count)
 
     int spanRows, spanCols;
     for (const auto& key : keys) {
-        std::map<CellAddress, Cell*>::iterator j = data.find(key);
+        auto j = data.find(key);
 
         assert(j != data.end());
 
@@ -1052,10 +1053,7 @@ void PropertySheet::removeRows(int row, int count)
             else {
                 spanRows = key.row() - row;
             }
-            mergeCells(
-                j->first,
-                CellAddress(j->first.row() + spanRows - 1, j->first.col() + spanCols - 1)
-            );
+            mergeCells(key, CellAddress(key.row() + spanRows - 1, key.col() + spanCols - 1));
         }
     }
 
@@ -1090,7 +1088,7 @@ void PropertySheet::insertColumns(int col, int count)
     }
 
     for (std::vector<CellAddress>::const_reverse_iterator i = keys.rbegin(); i != keys.rend(); ++i) {
-        std::map<CellAddress, Cell*>::iterator j = data.find(*i);
+        auto j = data.find(*i);
 
         assert(j != data.end());
 
@@ -1172,7 +1170,7 @@ void PropertySheet::removeColumns(int col, int count)
 
     int spanRows, spanCols;
     for (const auto& key : keys) {
-        std::map<CellAddress, Cell*>::iterator j = data.find(key);
+        auto j = data.find(key);
 
         assert(j != data.end());
 
@@ -1199,10 +1197,7 @@ void PropertySheet::removeColumns(int col, int count)
             else {
                 spanCols = key.col() - col;
             }
-            mergeCells(
-                j->first,
-                CellAddress(j->first.row() + spanRows - 1, j->first.col() + spanCols - 1)
-            );
+            mergeCells(key, CellAddress(key.row() + spanRows - 1, key.col() + spanCols - 1));
         }
     }
 
@@ -1215,7 +1210,8 @@ void PropertySheet::removeColumns(int col, int count)
 
 unsigned int PropertySheet::getMemSize() const
 {
-    return sizeof(*this);
+    return sizeof(*this) + data.getMemSize() + propertyDeps.getMemSize()
+        + documentObjectDeps.getMemSize();
 }
 
 
@@ -1363,8 +1359,7 @@ void PropertySheet::addDependencies(CellAddress key)
 
             std::string docObjName = docObj->getFullName();
 
-            documentObjectToCellMap[docObjName].insert(key);
-            cellToDocumentObjectMap[key].insert(docObjName);
+            documentObjectDeps.insert(key, docObjName);
             ++updateCount;
 
             for (auto& name : dep.second) {
@@ -1372,8 +1367,7 @@ void PropertySheet::addDependencies(CellAddress key)
                 FC_LOG("dep " << key.toString() << " -> " << name);
 
                 // Insert into maps
-                propertyNameToCellMap[propName].insert(key);
-                cellToPropertyNameMap[key].insert(propName);
+                propertyDeps.insert(key, propName);
 
                 // Also an alias?
                 if (!name.empty() && docObj->isDerivedFrom<Sheet>()) {
@@ -1385,8 +1379,7 @@ void PropertySheet::addDependencies(CellAddress key)
                         FC_LOG("dep " << key.toString() << " -> " << propName);
 
                         // Insert into maps
-                        propertyNameToCellMap[propName].insert(key);
-                        cellToPropertyNameMap[key].insert(std::move(propName));
+                        propertyDeps.insert(key, propName);
                     }
                 }
             }
@@ -1405,47 +1398,10 @@ void PropertySheet::addDependencies(CellAddress key)
 void PropertySheet::removeDependencies(CellAddress key)
 {
     /* Remove from Property <-> Key maps */
-
-    std::map<CellAddress, std::set<std::string>>::iterator i1 = cellToPropertyNameMap.find(key);
-
-    if (i1 != cellToPropertyNameMap.end()) {
-        std::set<std::string>::const_iterator j = i1->second.begin();
-
-        while (j != i1->second.end()) {
-            std::map<std::string, std::set<CellAddress>>::iterator k = propertyNameToCellMap.find(*j);
-
-            // assert(k != propertyNameToCellMap.end());
-            if (k != propertyNameToCellMap.end()) {
-                k->second.erase(key);
-            }
-            ++j;
-        }
-
-        cellToPropertyNameMap.erase(i1);
-    }
+    propertyDeps.erase(key);
 
     /* Remove from DocumentObject <-> Key maps */
-
-    std::map<CellAddress, std::set<std::string>>::iterator i2 = cellToDocumentObjectMap.find(key);
-
-    if (i2 != cellToDocumentObjectMap.end()) {
-        std::set<std::string>::const_iterator j = i2->second.begin();
-
-        while (j != i2->second.end()) {
-            std::map<std::string, std::set<CellAddress>>::iterator k = documentObjectToCellMap.find(*j);
-
-            if (k != documentObjectToCellMap.end()) {
-                k->second.erase(key);
-
-                if (k->second.empty()) {
-                    documentObjectToCellMap.erase(*j);
-                }
-            }
-
-            ++j;
-        }
-
-        cellToDocumentObjectMap.erase(i2);
+    if (documentObjectDeps.erase(key)) {
         ++updateCount;
     }
 }
@@ -1475,20 +1431,14 @@ void PropertySheet::recomputeDependants(const App::DocumentObject* owner, const
     // top parent object instead, and mark the involved expression
     // whenever the top parent changes.
     std::string fullName = owner->getFullName() + ".";
-    auto it = propertyNameToCellMap.find(fullName);
-    if (it != propertyNameToCellMap.end()) {
-        for (auto& cell : it->second) {
-            setDirty(cell);
-        }
+    for (const auto& cell : propertyDeps.getCells(fullName)) {
+        setDirty(cell);
     }
 
     if (propName && *propName) {
         // Now, we check for direct property references
-        it = propertyNameToCellMap.find(fullName + propName);
-        if (it != propertyNameToCellMap.end()) {
-            for (auto& cell : it->second) {
-                setDirty(cell);
-            }
+        for (const auto& cell : propertyDeps.getCells(fullName + propName)) {
+            setDirty(cell);
         }
     }
 }
@@ -1515,8 +1465,8 @@ void PropertySheet::invalidateDependants(const App::DocumentObject* docObj)
     depConnections.erase(docObj);
 
     // Recompute cells that depend on this cell
-    auto iter = documentObjectToCellMap.find(docObj->getFullName());
-    if (iter == documentObjectToCellMap.end()) {
+    const auto& cells = documentObjectDeps.getCells(docObj->getFullName());
+    if (cells.empty()) {
         return;
     }
 
@@ -1525,7 +1475,7 @@ void PropertySheet::invalidateDependants(const App::DocumentObject* docObj)
 
     AtomicPropertyChange signaller(*this);
 
-    for (const auto& address : iter->second) {
+    for (const auto& address : cells) {
         Cell* cell = getValue(address);
         cell->setResolveException("Unresolved dependency");
         setDirty(address);
@@ -1616,30 +1566,15 @@ void PropertySheet::deletedDocumentObject(const App::DocumentObject* docObj)
 void PropertySheet::documentSet()
 {}
 
-const std::set<CellAddress>& PropertySheet::getDeps(const std::string& name) const
+std::set<CellAddress> PropertySheet::getDeps(const std::string& name) const
 {
-    static std::set<CellAddress> empty;
-    std::map<std::string, std::set<CellAddress>>::const_iterator i = propertyNameToCellMap.find(name);
-
-    if (i != propertyNameToCellMap.end()) {
-        return i->second;
-    }
-    else {
-        return empty;
-    }
+    const auto& cells = propertyDeps.getCells(name);
+    return {cells.begin(), cells.end()};
 }
 
-const std::set<std::string>& PropertySheet::getDeps(CellAddress pos) const
+std::set<std::string> PropertySheet::getDeps(CellAddress pos) const
 {
-    static std::set<std::string> empty;
-    std::map<CellAddress, std::set<std::string>>::const_iterator i = cellToPropertyNameMap.find(pos);
-
-    if (i != cellToPropertyNameMap.end()) {
-        return i->second;
-    }
-    else {
-        return empty;
-    }
+    return propertyDeps.getNames(pos);
 }
 
 void PropertySheet::recomputeDependencies(CellAddress key)
@@ -1752,12 +1687,12 @@ void PropertySheet::afterRestore()
         if (!xlink.checkRestore()) {
             continue;
         }
-        auto iter = documentObjectToCellMap.find(xlink.getValue()->getFullName());
-        if (iter == documentObjectToCellMap.end()) {
+        const auto& cells = documentObjectDeps.getCells(xlink.getValue()->getFullName());
+        if (cells.empty()) {
             continue;
         }
         touch();
-        for (const auto& address : iter->second) {
+        for (const auto& address : cells) {
             setDirty(address);
         }
     }
@@ -1941,12 +1876,12 @@ void PropertySheet::setExpressions(std::map<App::ObjectIdentifier, App::Expressi
     AtomicPropertyChange signaller(*this);
     for (auto& v : exprs) {
         CellAddress addr(v.first.getPropertyName().c_str());
-        auto& cell = data[addr];
+        Cell* cell = getValue(addr);
         if (!cell) {
             if (!v.second) {
                 continue;
             }
-            cell = new Cell(addr, this);
+            cell = createCell(addr);
         }
         if (!v.second) {
             clear(addr);
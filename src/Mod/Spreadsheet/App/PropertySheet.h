@@ -38,6 +38,7 @@
 #include <Mod/Spreadsheet/SpreadsheetGlobal.h>
 
 #include "Cell.h"
+#include "CellStore.h"
 
 
 namespace Spreadsheet
@@ -111,6 +112,19 @@ public:
 
     void setContent(App::CellAddress address, const char* value);
 
+    /// Content of a cell for setContents()
+    struct CellContent
+    {
+        App::CellAddress address;
+        /// The expression of a literal content, see Cell::parseLiteral()
+        App::ExpressionPtr literal;
+        bool isLiteral {false};
+        /// The content, if it is not a literal
+        std::string text;
+    };
+
+    void setContents(std::vector<CellContent>& contents);
+
     void setAlignment(App::CellAddress address, int _alignment);
 
     void setStyle(App::CellAddress address, const std::set<std::string>& _style);
@@ -212,9 +226,9 @@ public:
 
     bool isHidden(App::CellAddress address) const;
 
-    const std::set<App::CellAddress>& getDeps(const std::string& name) const;
+    std::set<App::CellAddress> getDeps(const std::string& name) const;
 
-    const std::set<std::string>& getDeps(App::CellAddress pos) const;
+    std::set<std::string> getDeps(App::CellAddress pos) const;
 
     void recomputeDependencies(App::CellAddress key);
 
@@ -298,7 +312,7 @@ private:
     std::set<App::CellAddress> dirty;
 
     /*! Cell data in this property */
-    std::map<App::CellAddress, Cell*> data;
+    CellStore data;
 
     /*! Merged cells; cell -> anchor cell */
     std::map<App::CellAddress, App::CellAddress> mergedCells;
@@ -327,21 +341,15 @@ private:
     void slotChangedObject(const App::DocumentObject& obj, const App::Property& prop);
     void recomputeDependants(const App::DocumentObject* obj, const char* propName);
 
-    /*! Cell dependencies, i.e when a change occurs to property given in key,
-      the set of addresses needs to be recomputed.
+    /*! Cell dependencies on properties, i.e when a change occurs to a property,
+      the cells depending on its name need to be recomputed.
       */
-    std::map<std::string, std::set<App::CellAddress>> propertyNameToCellMap;
-
-    /*! Properties this cell depends on */
-    std::map<App::CellAddress, std::set<std::string>> cellToPropertyNameMap;
+    CellDependencyMap propertyDeps;
 
-    /*! Cell dependencies, i.e when a change occurs to documentObject given in key,
-      the set of addresses needs to be recomputed.
+    /*! Cell dependencies on document objects, i.e when a change occurs to a
+      documentObject, the cells depending on its name need to be recomputed.
       */
-    std::map<std::string, std::set<App::CellAddress>> documentObjectToCellMap;
-
-    /*! DocumentObject this cell depends on */
-    std::map<App::CellAddress, std::set<std::string>> cellToDocumentObjectMap;
+    CellDependencyMap documentObjectDeps;
 
     /*! Mapping of cell position to alias property */
     std::map<App::CellAddress, std::string> aliasProp;
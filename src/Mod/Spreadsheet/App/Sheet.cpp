@@ -24,14 +24,21 @@
 
 #include <boost/tokenizer.hpp>
 #include <boost/regex.hpp>
+#include <algorithm>
+#include <atomic>
 #include <deque>
+#include <future>
+#include <iterator>
 #include <memory>
 #include <sstream>
+#include <thread>
 #include <tuple>
 #include <list>
 #include <map>
 #include <string>
+#include <string_view>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 #include <boost_graph_adjacency_list.hpp>
@@ -73,6 +80,35 @@ using Traits = boost::graph_traits<DependencyList>;
 using Vertex = Traits::vertex_descriptor;
 using Edge = Traits::edge_descriptor;
 
+// Levels with fewer cells are recomputed on the calling thread only
+constexpr std::size_t minParallelCells = 256;
+// Minimum number of cells of a level evaluated by each thread
+constexpr std::size_t cellsPerThread = 64;
+// Number of lines of a file imported by each thread at once
+constexpr std::size_t importChunkLines = 1024;
+
+// Set on the threads evaluating cells concurrently, see Sheet::recomputeLevel()
+static thread_local bool evaluatingConcurrently = false;
+
+// Whether the property \a path refers to can be read by the threads evaluating cells
+// concurrently. Resolving a sub-object or reading a Python feature may need the GIL, which the
+// thread waiting for them may hold.
+static bool isNativeProperty(const ObjectIdentifier& path)
+{
+    if (!path.getSubObjectName().empty()) {
+        return false;
+    }
+    Property* prop = path.getProperty();
+    auto obj = prop ? freecad_cast<DocumentObject*>(prop->getContainer()) : nullptr;
+    return obj && !freecad_cast<PropertyPythonObject*>(obj->getPropertyByName("Proxy"));
+}
+
+static unsigned int cellKey(CellAddress address)
+{
+    return (static_cast<unsigned int>(address.row()) << 16)
+        | static_cast<unsigned short>(address.col());
+}
+
 /**
  * Construct a new Sheet object.
  */
@@ -151,6 +187,7 @@ void Sheet::clearAll()
     }
 
     propAddress.clear();
+    exposedCells.clear();
     cellErrors.clear();
     columnWidths.clear();
     rowHeights.clear();
@@ -222,54 +259,93 @@ bool Sheet::importFromFile(const std::string& filename, char delimiter, char quo
 {
     Base::FileInfo fi(filename);
     Base::ifstream file(fi, std::ios::in);
-    int row = 0;
 
-    PropertySheet::AtomicPropertyChange signaller(cells);
+    if (!file.is_open()) {
+        return false;
+    }
 
-    clearAll();
+    std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
 
-    if (file.is_open()) {
-        std::string line;
+    std::vector<std::string_view> lines;
+    for (std::size_t pos = 0; pos < text.size();) {
+        std::size_t end = std::min(text.find('\n', pos), text.size());
+        lines.emplace_back(text.data() + pos, end - pos);
+        pos = end + 1;
+    }
 
-        while (std::getline(file, line)) {
-            using namespace boost;
+    using Separator = boost::escaped_list_separator<char>;
+    using Tokenizer = boost::tokenizer<Separator, std::string_view::const_iterator>;
+    Separator separator = quoteChar ? Separator(escapeChar, delimiter, quoteChar)
+                                    : Separator('\0', delimiter, '\0');
 
+    // Split the lines into cells and parse the literal contents, in chunks of lines that are
+    // processed concurrently. A chunk stops at the first line that cannot be split.
+    struct Chunk
+    {
+        std::vector<PropertySheet::CellContent> contents;
+        bool failed {false};
+    };
+    std::vector<Chunk> chunks((lines.size() + importChunkLines - 1) / importChunkLines);
+    auto parseChunk = [&](std::size_t index) {
+        Chunk& chunk = chunks[index];
+        std::size_t last = std::min(lines.size(), (index + 1) * importChunkLines);
+        for (std::size_t row = index * importChunkLines; row < last; ++row) {
             try {
-                escaped_list_separator<char> e;
+                Tokenizer tok(lines[row].begin(), lines[row].end(), separator);
                 int col = 0;
-
-                if (quoteChar) {
-                    e = escaped_list_separator<char>(escapeChar, delimiter, quoteChar);
-                }
-                else {
-                    e = escaped_list_separator<char>('\0', delimiter, '\0');
-                }
-
-                tokenizer<escaped_list_separator<char>> tok(line, e);
-
-                for (tokenizer<escaped_list_separator<char>>::iterator i = tok.begin();
-                     i != tok.end();
-                     ++i) {
-                    if (!i->empty()) {
-                        setCell(CellAddress(row, col), (*i).c_str());
+                for (const auto& token : tok) {
+                    if (!token.empty()) {
+                        auto& content = chunk.contents.emplace_back();
+                        content.address = CellAddress(static_cast<int>(row), col);
+                        content.isLiteral = Cell::parseLiteral(this, token.c_str(), content.literal);
+                        if (!content.isLiteral) {
+                            content.text = token;
+                        }
                     }
                     col++;
                 }
             }
             catch (...) {
-                signaller.tryInvoke();
-                return false;
+                chunk.failed = true;
+                return;
             }
+        }
+    };
 
-            ++row;
+    std::size_t numThreads = std::thread::hardware_concurrency();
+    numThreads = std::min(numThreads, chunks.size());
+    std::atomic<std::size_t> next {0};
+    auto worker = [&]() {
+        for (std::size_t index = next++; index < chunks.size(); index = next++) {
+            parseChunk(index);
         }
-        file.close();
-        signaller.tryInvoke();
-        return true;
+    };
+    std::vector<std::future<void>> futures;
+    for (std::size_t i = 1; i < numThreads; i++) {
+        futures.push_back(std::async(std::launch::async, worker));
     }
-    else {
-        return false;
+    worker();
+    for (auto& fut : futures) {
+        fut.get();
+    }
+
+    // Set the cells up to the first line that could not be split
+    PropertySheet::AtomicPropertyChange signaller(cells);
+
+    clearAll();
+
+    bool failed = false;
+    for (auto& chunk : chunks) {
+        cells.setContents(chunk.contents);
+        if (chunk.failed) {
+            failed = true;
+            break;
+        }
     }
+
+    signaller.tryInvoke();
+    return !failed;
 }
 
 /**
@@ -297,6 +373,30 @@ static void writeEscaped(std::string const& s, char quoteChar, char escapeChar,
     out << quoteChar;
 }
 
+/**
+ * Write the computed value \a value of a cell to \a out, formatted like its property.
+ */
+
+static void writeValue(const App::Expression* value, std::ostream& out)
+{
+    if (auto number = freecad_cast<const NumberExpression*>(value)) {
+        long l;
+        auto constant = freecad_cast<const ConstantExpression*>(value);
+        if (constant && !constant->isNumber()) {
+            return;
+        }
+        else if (number->getUnit() != Unit::One || !number->isInteger(&l)) {
+            out << number->getValue();
+        }
+        else {
+            out << l;
+        }
+    }
+    else if (auto str = freecad_cast<const StringExpression*>(value)) {
+        out << str->getText();
+    }
+}
+
 /**
  * Export spreadsheet data to file.
  *
@@ -321,42 +421,34 @@ bool Sheet::exportToFile(const std::string& filename, char delimiter, char quote
         return false;
     }
 
-    auto usedCells = cells.getNonEmptyCells();
-    auto i = usedCells.begin();
-
-    while (i != usedCells.end()) {
-        Property* prop = getProperty(*i);
+    // The cells are visited in address order, and their values written directly instead of
+    // through their properties, which would have to be created.
+    std::ostringstream field;
+    int firstCol = -1;
+    for (const auto& i : cells.data) {
+        CellAddress address = i.first;
+        const Cell* cell = i.second;
+        if (!cell->isUsed() || !cell->getExpression()) {
+            continue;
+        }
+        if (firstCol == -1) {
+            firstCol = address.col();
+        }
 
-        if (prevRow != -1 && prevRow != i->row()) {
-            for (int j = prevRow; j < i->row(); ++j) {
-                file << std::endl;
+        if (prevRow != -1 && prevRow != address.row()) {
+            for (int j = prevRow; j < address.row(); ++j) {
+                file << '\n';
             }
-            prevCol = usedCells.begin()->col();
+            prevCol = firstCol;
         }
-        if (prevCol != -1 && i->col() != prevCol) {
-            for (int j = prevCol; j < i->col(); ++j) {
+        if (prevCol != -1 && address.col() != prevCol) {
+            for (int j = prevCol; j < address.col(); ++j) {
                 file << delimiter;
             }
         }
 
-        std::stringstream field;
-
-        if (auto p = freecad_cast<PropertyQuantity*>(prop)) {
-            field << p->getValue();
-        }
-        else if (auto p = freecad_cast<PropertyFloat*>(prop)) {
-            field << p->getValue();
-        }
-        else if (auto p = freecad_cast<PropertyInteger*>(prop)) {
-            field << p->getValue();
-        }
-        else if (auto p = freecad_cast<PropertyString*>(prop)) {
-            field << p->getValue();
-        }
-        else {
-            assert(0);
-        }
-
+        field.str(std::string());
+        writeValue(cell->getComputedValue(), field);
         std::string str = field.str();
 
         if (quoteChar && str.find_first_of(std::string(quoteChar, delimiter)) != std::string::npos) {
@@ -366,9 +458,8 @@ bool Sheet::exportToFile(const std::string& filename, char delimiter, char quote
             file << str;
         }
 
-        prevRow = i->row();
-        prevCol = i->col();
-        ++i;
+        prevRow = address.row();
+        prevCol = address.col();
     }
     file << std::endl;
     file.close();
@@ -495,9 +586,12 @@ PyObject* Sheet::getPyObject()
 }
 
 /**
- * Get the Cell Property for the cell at \a key.
+ * Get the Cell Property for the cell at \a key, if it exists.
  *
- * @returns The Property object.
+ * The value of a cell is kept by the cell itself, see Cell::getComputedValue(). Its property
+ * only exists once the cell is exposed, see exposeCell().
+ *
+ * @returns The Property object, or 0 if the cell has none.
  *
  */
 
@@ -506,6 +600,37 @@ Property* Sheet::getProperty(CellAddress key) const
     return props.getDynamicPropertyByName(key.toString(CellAddress::Cell::ShowRowColumn).c_str());
 }
 
+/**
+ * Get the Cell Property for the cell at \a key, creating it if needed.
+ *
+ * This is done for the callers resolving the property, i.e. expressions referring to the cell
+ * and Python. From then on, the cell is exposed and its property is updated each time the cell
+ * is recomputed.
+ *
+ * @returns The Property object, or 0 if the cell has no value.
+ *
+ */
+
+Property* Sheet::exposeCell(CellAddress key)
+{
+    Property* prop = getProperty(key);
+    if (prop || evaluatingConcurrently) {
+        // Properties are not created while cells are evaluated concurrently, the cells failing
+        // because of it are evaluated again afterwards.
+        return prop;
+    }
+
+    // Also remember cells without a value yet, so that their property is created and signals
+    // its change when they get one.
+    exposedCells.insert(key);
+
+    const Cell* cell = cells.getValue(key);
+    if (!cell || !cell->getComputedValue()) {
+        return nullptr;
+    }
+    return setComputedProperty(key, cell->getComputedValue());
+}
+
 /**
  * @brief Get a dynamic property.
  * @param addr Name of dynamic propeerty.
@@ -774,14 +899,15 @@ struct CurrentAddressLock
 };
 
 /**
- * Update the Property given by \a key. This will also eventually trigger recomputations of cells
- * depending on \a key.
+ * Update the value of the cell given by \a key, and its Property if the cell is exposed. This
+ * will also eventually trigger recomputations of cells depending on \a key.
  *
- * @param key The address of the cell we want to recompute.
+ * @param key   The address of the cell we want to recompute.
+ * @param value The value of the cell if it is already evaluated, or 0 to evaluate it.
  *
  */
 
-void Sheet::updateProperty(CellAddress key)
+void Sheet::updateProperty(CellAddress key, App::ExpressionPtr value)
 {
     Cell* cell = getCell(key);
 
@@ -789,7 +915,10 @@ void Sheet::updateProperty(CellAddress key)
         std::unique_ptr<Expression> output;
         const Expression* input = cell->getExpression();
 
-        if (input) {
+        if (value) {
+            output = std::move(value);
+        }
+        else if (input) {
             CurrentAddressLock lock(currentRow, currentCol, key);
             output = input->eval();
         }
@@ -800,6 +929,7 @@ void Sheet::updateProperty(CellAddress key)
                 output = std::make_unique<StringExpression>(this, s);
             }
             else {
+                cell->setComputedValue(nullptr);
                 this->removeDynamicProperty(key.toString().c_str());
                 return;
             }
@@ -808,39 +938,12 @@ void Sheet::updateProperty(CellAddress key)
         /* Eval returns either NumberExpression or StringExpression, or
          * PyObjectExpression objects */
         auto number = freecad_cast<NumberExpression*>(output.get());
-        if (number) {
-            long l;
-            auto constant = freecad_cast<ConstantExpression*>(output.get());
-            if (constant && !constant->isNumber()) {
-                Base::PyGILStateLocker lock;
-                setObjectProperty(key, constant->getPyValue());
-            }
-            else if (number->getUnit() != Unit::One) {
-                setQuantityProperty(key, number->getValue(), number->getUnit());
-            }
-            else if (number->isInteger(&l)) {
-                setIntegerProperty(key, l);
-            }
-            else {
-                setFloatProperty(key, number->getValue());
-            }
-        }
-        else {
-            auto str_expr = freecad_cast<StringExpression*>(output.get());
-            if (str_expr) {
-                setStringProperty(key, str_expr->getText().c_str());
-            }
-            else {
-                Base::PyGILStateLocker lock;
-                auto py_expr = freecad_cast<PyObjectExpression*>(output.get());
-                if (py_expr) {
-                    setObjectProperty(key, py_expr->getPyValue());
-                }
-                else {
-                    setObjectProperty(key, Py::Object());
-                }
-            }
+        auto constant = freecad_cast<ConstantExpression*>(output.get());
+        if (number && (!constant || constant->isNumber()) && number->getUnit() != Unit::One) {
+            cells.setComputedUnit(key, number->getUnit());
         }
+
+        setComputedValue(key, std::move(output));
     }
     else {
         clear(key);
@@ -849,6 +952,82 @@ void Sheet::updateProperty(CellAddress key)
     cellUpdated(key);
 }
 
+/**
+ * Store \a value as the computed value of the cell at \a key.
+ *
+ * The value is kept by the cell. The property of the cell is only created or updated if the cell
+ * is aliased or exposed, see exposeCell(), or if it already exists.
+ *
+ * @param key   The address of the cell.
+ * @param value The result of evaluating the cell.
+ *
+ */
+
+void Sheet::setComputedValue(CellAddress key, App::ExpressionPtr&& value)
+{
+    Cell* cell = getCell(key);
+
+    if (!cell) {
+        // Nothing to keep the value, e.g. the error of a cell that was removed meanwhile
+        setComputedProperty(key, value.get());
+        return;
+    }
+
+    cell->setComputedValue(std::move(value));
+
+    // A property that exists is kept up to date even if the cell is no longer aliased
+    std::string alias;
+    if (cell->getAlias(alias) || exposedCells.count(key) > 0
+        || props.getDynamicPropertyByName(key.toString().c_str())) {
+        setComputedProperty(key, cell->getComputedValue());
+    }
+}
+
+/**
+ * Set the property of the cell at \a key to the computed value \a value, creating the property
+ * with the type matching the value if needed.
+ *
+ * @param key   The address of the cell.
+ * @param value A NumberExpression, StringExpression or PyObjectExpression.
+ *
+ * @returns The Property object.
+ *
+ */
+
+Property* Sheet::setComputedProperty(CellAddress key, const App::Expression* value)
+{
+    auto number = freecad_cast<const NumberExpression*>(value);
+    if (number) {
+        long l;
+        auto constant = freecad_cast<const ConstantExpression*>(value);
+        if (constant && !constant->isNumber()) {
+            Base::PyGILStateLocker lock;
+            return setObjectProperty(key, constant->getPyValue());
+        }
+        else if (number->getUnit() != Unit::One) {
+            return setQuantityProperty(key, number->getValue(), number->getUnit());
+        }
+        else if (number->isInteger(&l)) {
+            return setIntegerProperty(key, l);
+        }
+        else {
+            return setFloatProperty(key, number->getValue());
+        }
+    }
+
+    auto str_expr = freecad_cast<const StringExpression*>(value);
+    if (str_expr) {
+        return setStringProperty(key, str_expr->getText().c_str());
+    }
+
+    Base::PyGILStateLocker lock;
+    auto py_expr = freecad_cast<const PyObjectExpression*>(value);
+    if (py_expr) {
+        return setObjectProperty(key, py_expr->getPyValue());
+    }
+    return setObjectProperty(key, Py::Object());
+}
+
 /**
  * Retrieve a specific Property given by \a name.
  * This function might throw an exception if something fails, but might also
@@ -863,7 +1042,8 @@ Property* Sheet::getPropertyByName(const char* name) const
     CellAddress addr = getCellAddress(name, true);
     Property* prop = nullptr;
     if (addr.isValid()) {
-        prop = getProperty(addr);
+        // Expressions and Python resolve the cells through here
+        prop = const_cast<Sheet*>(this)->exposeCell(addr);
     }
     if (prop) {
         return prop;
@@ -878,7 +1058,7 @@ Property* Sheet::getDynamicPropertyByName(const char* name) const
     CellAddress addr = getCellAddress(name, true);
     Property* prop = nullptr;
     if (addr.isValid()) {
-        prop = getProperty(addr);
+        prop = const_cast<Sheet*>(this)->exposeCell(addr);
     }
     if (prop) {
         return prop;
@@ -928,9 +1108,10 @@ void Sheet::recomputeCells(Range range)
 /**
  * @brief Recompute cell at address \a p.
  * @param p Address of cell.
+ * @param value Value of the cell if it is already evaluated, see recomputeLevel().
  */
 
-void Sheet::recomputeCell(CellAddress p)
+void Sheet::recomputeCell(CellAddress p, App::ExpressionPtr value)
 {
     Cell* cell = cells.getValue(p);
 
@@ -941,7 +1122,7 @@ void Sheet::recomputeCell(CellAddress p)
             cell->setContent(content.c_str());
         }
 
-        updateProperty(p);
+        updateProperty(p, std::move(value));
 
         if (!cell || !cell->hasException()) {
             cells.clearDirty(p);
@@ -951,7 +1132,7 @@ void Sheet::recomputeCell(CellAddress p)
     catch (const Base::Exception& e) {
         QString msg = QStringLiteral("ERR: %1").arg(QString::fromUtf8(e.what()));
 
-        setStringProperty(p, msg.toStdString());
+        setComputedValue(p, std::make_unique<StringExpression>(this, msg.toStdString()));
         if (cell) {
             cell->setException(e.what());
         }
@@ -969,6 +1150,88 @@ void Sheet::recomputeCell(CellAddress p)
     }
 }
 
+/**
+ * @brief Evaluate the cell at \a address without Python, if possible.
+ *
+ * This is called concurrently for the cells of a level, so it must neither modify the sheet nor
+ * report errors. Only cells reading plain properties of C++ objects are evaluated, the ones it
+ * cannot evaluate are recomputed afterwards by recomputeCell().
+ *
+ * @param address Address of cell.
+ * @returns The value of the cell, or 0 if it could not be evaluated.
+ */
+
+App::ExpressionPtr Sheet::evaluateNative(CellAddress address) const
+{
+    const Cell* cell = cells.getValue(address);
+    const Expression* input = cell ? cell->getExpression() : nullptr;
+    if (!input || cell->hasException()) {
+        return nullptr;
+    }
+
+    try {
+        for (const auto& [path, hidden] : input->getIdentifiers()) {
+            if (!isNativeProperty(path)) {
+                return nullptr;
+            }
+        }
+
+        Quantity value;
+        Expression::NativeType type;
+        if (input->getNativeValue(value, type)) {
+            return std::make_unique<NumberExpression>(this, value);
+        }
+    }
+    catch (...) {
+        // Evaluated again by recomputeCell(), which reports the error
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Recompute the cells of a dependency level.
+ *
+ * The cells of a level do not depend on each other. For large levels, the cells that can be
+ * evaluated without Python are evaluated concurrently first. The values are then committed, and
+ * the other cells recomputed, on the calling thread in the order of \a level.
+ *
+ * @param level Addresses of the cells.
+ */
+
+void Sheet::recomputeLevel(const std::vector<CellAddress>& level)
+{
+    std::vector<App::ExpressionPtr> values(level.size());
+
+    std::size_t numThreads = std::thread::hardware_concurrency();
+    numThreads = std::min(numThreads, level.size() / cellsPerThread);
+    if (level.size() >= minParallelCells && numThreads > 1) {
+        std::atomic<std::size_t> next {0};
+        auto worker = [&]() {
+            evaluatingConcurrently = true;
+            for (std::size_t index = next++; index < level.size(); index = next++) {
+                values[index] = evaluateNative(level[index]);
+            }
+            evaluatingConcurrently = false;
+        };
+        std::vector<std::future<void>> futures;
+        for (std::size_t i = 1; i < numThreads; i++) {
+            futures.push_back(std::async(std::launch::async, worker));
+        }
+        worker();
+        for (auto& fut : futures) {
+            fut.get();
+        }
+        concurrentCells += std::count_if(values.begin(), values.end(), [](const auto& value) {
+            return value != nullptr;
+        });
+    }
+
+    for (std::size_t i = 0; i < level.size(); ++i) {
+        FC_TRACE(level[i].toString());
+        recomputeCell(level[i], std::move(values[i]));
+    }
+}
+
 PropertySheet::BindingType Sheet::getCellBinding(
     Range& range,
     ExpressionPtr* pStart,
@@ -1080,58 +1343,77 @@ DocumentObjectExecReturn* Sheet::execute()
         dirtyCells.insert(cellError);
     }
 
-    DependencyList graph;
-    std::map<CellAddress, Vertex> VertexList;
-    std::map<Vertex, CellAddress> VertexIndexList;
-    std::deque<CellAddress> workQueue(dirtyCells.begin(), dirtyCells.end());
-    while (!workQueue.empty()) {
-        CellAddress currPos = workQueue.front();
-        workQueue.pop_front();
-
-        // Insert into map of CellPos -> Index, if it doesn't exist already
-        auto res = VertexList.emplace(currPos, Vertex());
+    // Find the cells depending on the dirty ones, using the dependency index kept up to date by
+    // PropertySheet, and group them into levels. The cells of a level only depend on cells of the
+    // previous levels, or on cells that are not recomputed.
+    std::vector<CellAddress> addresses;
+    std::vector<std::vector<std::size_t>> dependants;
+    std::vector<int> pending;  // number of dependencies of each cell that are not computed yet
+    std::unordered_map<unsigned int, std::size_t> indices;
+    auto vertex = [&](CellAddress address) {
+        auto res = indices.try_emplace(cellKey(address), addresses.size());
         if (res.second) {
-            res.first->second = add_vertex(graph);
-            VertexIndexList[res.first->second] = currPos;
-        }
-
-        // Process cells that depend on the current cell
-        for (auto& dep : providesTo(currPos)) {
-            auto resDep = VertexList.emplace(dep, Vertex());
-            if (resDep.second) {
-                resDep.first->second = add_vertex(graph);
-                VertexIndexList[resDep.first->second] = dep;
-                if (dirtyCells.insert(dep).second) {
-                    workQueue.push_back(dep);
+            addresses.push_back(address);
+            dependants.emplace_back();
+            pending.push_back(0);
+        }
+        return res.first->second;
+    };
+    for (const auto& address : dirtyCells) {
+        vertex(address);
+    }
+    const std::string prefix = getFullName() + ".";
+    for (std::size_t i = 0; i < addresses.size(); ++i) {
+        for (const auto& dep : cells.propertyDeps.getCells(prefix + addresses[i].toString())) {
+            std::size_t j = vertex(dep);
+            dependants[i].push_back(j);
+            ++pending[j];
+        }
+    }
+
+    std::vector<std::vector<CellAddress>> levels;
+    std::vector<std::size_t> current;
+    for (std::size_t i = 0; i < addresses.size(); ++i) {
+        if (pending[i] == 0) {
+            current.push_back(i);
+        }
+    }
+    std::size_t sorted = 0;
+    while (!current.empty()) {
+        sorted += current.size();
+        std::vector<std::size_t> next;
+        auto& level = levels.emplace_back();
+        level.reserve(current.size());
+        for (std::size_t i : current) {
+            level.push_back(addresses[i]);
+            for (std::size_t j : dependants[i]) {
+                if (--pending[j] == 0) {
+                    next.push_back(j);
                 }
             }
-            // Add edge to graph to signal dependency
-            add_edge(res.first->second, resDep.first->second, graph);
         }
+        current.swap(next);
     }
-    // Compute cells
-    std::list<Vertex> make_order;
-    // Sort graph topologically to find evaluation order
-    try {
-        boost::topological_sort(graph, std::front_inserter(make_order));
+
+    if (sorted == addresses.size()) {
         // Recompute cells
         FC_LOG("recomputing " << getFullName());
-        for (auto& pos : make_order) {
-            const auto& addr = VertexIndexList[pos];
-            FC_TRACE(addr.toString());
-            recomputeCell(addr);
+        concurrentCells = 0;
+        for (const auto& level : levels) {
+            recomputeLevel(level);
         }
     }
-    catch (std::exception&) {
-        for (auto& v : VertexList) {
-            Cell* cell = cells.getValue(v.first);
+    else {
+        for (const auto& address : addresses) {
+            Cell* cell = cells.getValue(address);
             // Mark as erroneous
             if (cell) {
-                cellErrors.insert(v.first);
+                cellErrors.insert(address);
                 cell->setException("Pending computation due to cyclic dependency", true);
-                cellUpdated(v.first);
+                cellUpdated(address);
             }
         }
+        dirtyCells.insert(addresses.begin(), addresses.end());
 
         // Try to be more user friendly by finding individual loops
         while (!dirtyCells.empty()) {
@@ -1392,6 +1674,22 @@ void Sheet::updateColumnsOrRows(bool horizontal, int section, int count)
             rowHeights.setValues(newsizes);
         }
     }
+
+    // Exposed cells move with their cells, whose references were renamed to the new address.
+    // Cells that were removed are no longer exposed.
+    std::set<CellAddress> exposed;
+    for (const auto& address : exposedCells) {
+        int index = horizontal ? address.col() : address.row();
+        if (index >= section) {
+            if (count < 0 && index < section - count) {
+                continue;
+            }
+            index += count;
+        }
+        exposed.insert(horizontal ? CellAddress(address.row(), index)
+                                  : CellAddress(index, address.col()));
+    }
+    exposedCells = std::move(exposed);
 }
 
 /**
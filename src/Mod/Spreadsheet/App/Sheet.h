@@ -249,6 +249,12 @@ public:
     const std::vector<App::Range>& getCopyOrCutRange(bool copy = true) const;
     unsigned getCopyOrCutBorder(App::CellAddress address, bool copy = true) const;
 
+    /// Number of cells evaluated concurrently during the last recompute
+    std::size_t getConcurrentlyEvaluatedCells() const
+    {
+        return concurrentCells;
+    }
+
 protected:
     void onChanged(const App::Property* prop) override;
 
@@ -258,13 +264,23 @@ protected:
 
     void onDocumentRestored() override;
 
-    void recomputeCell(App::CellAddress p);
+    void recomputeCell(App::CellAddress p, App::ExpressionPtr value = nullptr);
+
+    void recomputeLevel(const std::vector<App::CellAddress>& level);
+
+    App::ExpressionPtr evaluateNative(App::CellAddress address) const;
 
     App::Property* getProperty(App::CellAddress key) const;
 
+    App::Property* exposeCell(App::CellAddress key);
+
     App::Property* getProperty(const char* addr) const;
 
-    void updateProperty(App::CellAddress key);
+    void updateProperty(App::CellAddress key, App::ExpressionPtr value = nullptr);
+
+    void setComputedValue(App::CellAddress key, App::ExpressionPtr&& value);
+
+    App::Property* setComputedProperty(App::CellAddress key, const App::Expression* value);
 
     App::Property* setStringProperty(App::CellAddress key, const std::string& value);
 
@@ -286,9 +302,15 @@ protected:
     /* Mapping of properties to cell position */
     std::map<const App::Property*, App::CellAddress> propAddress;
 
+    /* Cells whose property was asked for, they keep it updated on recompute */
+    std::set<App::CellAddress> exposedCells;
+
     /* Set of cells with errors */
     std::set<App::CellAddress> cellErrors;
 
+    /* Number of cells evaluated concurrently during the last recompute */
+    std::size_t concurrentCells {0};
+
     /* Properties */
 
     /* Cell data */
@@ -28,6 +28,7 @@
 #include <QLocale>
 
 #include <App/Document.h>
+#include <App/ExpressionParser.h>
 #include <Base/Interpreter.h>
 #include <Base/Tools.h>
 #include <Base/UnitsApi.h>
@@ -277,9 +278,14 @@ QVariant SheetModel::data(const QModelIndex& index, int role) const
         return {};
     }
 
-    // Get display value as computed property
-    std::string address = CellAddress(row, col).toString();
-    Property* prop = sheet->getPropertyByName(address.c_str());
+    // Get display value as computed by the cell. Asking the sheet for the property of the cell
+    // would create and expose it for every painted cell.
+    const App::Expression* value = cell->getComputedValue();
+    auto numberValue = freecad_cast<const App::NumberExpression*>(value);
+    auto constant = freecad_cast<const App::ConstantExpression*>(value);
+    if (constant && !constant->isNumber()) {
+        numberValue = nullptr;
+    }
 
     if (role == Qt::BackgroundRole) {
         Base::Color color;
@@ -344,7 +350,7 @@ QVariant SheetModel::data(const QModelIndex& index, int role) const
     auto dirtyCells = sheet->getCells()->getDirty();
     auto dirty = (dirtyCells.find(CellAddress(row, col)) != dirtyCells.end());
 
-    if (!prop || dirty) {
+    if (!value || dirty) {
         switch (role) {
             case Qt::ForegroundRole: {
                 return QColor(
@@ -379,9 +385,8 @@ QVariant SheetModel::data(const QModelIndex& index, int role) const
                 return {};
         }
     }
-    else if (prop->isDerivedFrom<App::PropertyString>()) {
+    else if (auto stringValue = freecad_cast<const App::StringExpression*>(value)) {
         /* String */
-        const App::PropertyString* stringProp = static_cast<const App::PropertyString*>(prop);
 
         switch (role) {
             case Qt::ForegroundRole: {
@@ -397,7 +402,7 @@ QVariant SheetModel::data(const QModelIndex& index, int role) const
                 }
             }
             case Qt::DisplayRole: {
-                QString v = QString::fromUtf8(stringProp->getValue());
+                QString v = QString::fromUtf8(stringValue->getText().c_str());
                 return formatCellDisplay(v, cell);
             }
             case Qt::TextAlignmentRole: {
@@ -415,9 +420,8 @@ QVariant SheetModel::data(const QModelIndex& index, int role) const
                 return {};
         }
     }
-    else if (prop->isDerivedFrom<App::PropertyQuantity>()) {
+    else if (numberValue && numberValue->getUnit() != Base::Unit::One) {
         /* Number */
-        const App::PropertyQuantity* floatProp = static_cast<const App::PropertyQuantity*>(prop);
 
         switch (role) {
             case Qt::ForegroundRole: {
@@ -429,7 +433,7 @@ QVariant SheetModel::data(const QModelIndex& index, int role) const
                     );
                 }
                 else {
-                    if (floatProp->getValue() < 0) {
+                    if (numberValue->getValue() < 0) {
                         return QVariant::fromValue(QColor(negativeFgColor));
                     }
                     else {
@@ -450,14 +454,14 @@ QVariant SheetModel::data(const QModelIndex& index, int role) const
             }
             case Qt::DisplayRole: {
                 QString v;
-                const Base::Unit& computedUnit = floatProp->getUnit();
+                const Base::Unit& computedUnit = numberValue->getUnit();
                 DisplayUnit displayUnit;
 
                 // Display locale specific decimal separator (#0003875,#0003876)
                 if (cell->getDisplayUnit(displayUnit)) {
                     if (computedUnit == Base::Unit::One || computedUnit == displayUnit.unit) {
                         QString number = QLocale().toString(
-                            floatProp->getValue() / displayUnit.scaler,
+                            numberValue->getValue() / displayUnit.scaler,
                             'f',
                             Base::UnitsApi::getDecimals()
                         );
@@ -473,8 +477,7 @@ QVariant SheetModel::data(const QModelIndex& index, int role) const
 
                     // When displaying a quantity then use the globally set scheme
                     // See: https://forum.freecad.org/viewtopic.php?f=3&t=50078
-                    Base::Quantity value = floatProp->getQuantityValue();
-                    v = QString::fromStdString(value.getUserString());
+                    v = QString::fromStdString(numberValue->getQuantity().getUserString());
                 }
                 return formatCellDisplay(v, cell);
             }
@@ -482,20 +485,11 @@ QVariant SheetModel::data(const QModelIndex& index, int role) const
                 return {};
         }
     }
-    else if (prop->isDerivedFrom<App::PropertyFloat>()
-             || prop->isDerivedFrom<App::PropertyInteger>()) {
+    else if (numberValue) {
         /* Number */
-        double d {};
         long l {};
-        bool isInteger = false;
-        if (prop->isDerivedFrom<App::PropertyFloat>()) {
-            d = static_cast<const App::PropertyFloat*>(prop)->getValue();
-        }
-        else {
-            isInteger = true;
-            l = static_cast<const App::PropertyInteger*>(prop)->getValue();
-            d = l;
-        }
+        bool isInteger = numberValue->isInteger(&l);
+        double d = isInteger ? static_cast<double>(l) : numberValue->getValue();
 
         switch (role) {
             case Qt::ForegroundRole: {
@@ -553,8 +547,8 @@ QVariant SheetModel::data(const QModelIndex& index, int role) const
                 return {};
         }
     }
-    else if (prop->isDerivedFrom<App::PropertyPythonObject>()) {
-        auto pyProp = static_cast<const App::PropertyPythonObject*>(prop);
+    else {
+        /* Python object */
 
         switch (role) {
             case Qt::ForegroundRole: {
@@ -582,23 +576,23 @@ QVariant SheetModel::data(const QModelIndex& index, int role) const
             }
             case Qt::DisplayRole: {
                 Base::PyGILStateLocker lock;
-                std::string value;
+                std::string text;
                 try {
-                    value = pyProp->getValue().as_string();
+                    text = value->getPyValue().as_string();
                 }
                 catch (Py::Exception&) {
                     Base::PyException e;
-                    value = "#ERR: ";
-                    value += e.what();
+                    text = "#ERR: ";
+                    text += e.what();
                 }
                 catch (Base::Exception& e) {
-                    value = "#ERR: ";
-                    value += e.what();
+                    text = "#ERR: ";
+                    text += e.what();
                 }
                 catch (...) {
-                    value = "#ERR: unknown exception";
+                    text = "#ERR: unknown exception";
                 }
-                QString v = QString::fromUtf8(value.c_str());
+                QString v = QString::fromUtf8(text.c_str());
                 return formatCellDisplay(v, cell);
             }
             default:
@@ -0,0 +1,127 @@
+# SPDX-License-Identifier: LGPL-2.1-or-later
+# ***************************************************************************
+# *                                                                         *
+# *   This file is part of FreeCAD.                                         *
+# *                                                                         *
+# *   FreeCAD is free software: you can redistribute it and/or modify it    *
+# *   under the terms of the GNU Lesser General Public License as           *
+# *   published by the Free Software Foundation, either version 2.1 of the  *
+# *   License, or (at your option) any later version.                       *
+# *                                                                         *
+# *   FreeCAD is distributed in the hope that it will be useful, but        *
+# *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+# *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+# *   Lesser General Public License for more details.                       *
+# *                                                                         *
+# *   You should have received a copy of the GNU Lesser General Public      *
+# *   License along with FreeCAD. If not, see                               *
+# *   <https://www.gnu.org/licenses/>.                                      *
+# *                                                                         *
+# ***************************************************************************
+
+"""Performance test of the tree view with a large document.
+
+Builds a synthetic document of groups holding 100 objects each, 100k objects in total
+by default, saves it, and times in the tree view:
+ - opening the document until the item of every group is created,
+ - expanding every group,
+ - closing the document.
+
+Every measurement is printed as a JSON object on a line of its own, so that the results of
+different builds can be compared with standard tools.
+
+To run the test:
+    FreeCAD -t TestTreePerf [--pass <number of objects>]
+"""
+
+import json
+import os
+import sys
+import tempfile
+import time
+import unittest
+
+import FreeCAD
+import FreeCADGui
+
+from PySide6 import QtCore, QtWidgets
+
+GroupSize = 100
+Timeout = 600.0
+
+
+def wait(msec):
+    """Run the event loop for the given time, letting the timers of the tree fire."""
+    loop = QtCore.QEventLoop()
+    QtCore.QTimer.singleShot(msec, loop.quit)
+    loop.exec()
+
+
+class TestTreePerf(unittest.TestCase):
+    def setUp(self):
+        if not FreeCAD.GuiUp:
+            self.skipTest("The tree view needs the GUI")
+        count = 100000
+        if "--pass" in sys.argv:
+            count = int(sys.argv[sys.argv.index("--pass") + 1])
+        self.groups = max(1, count // (GroupSize + 1))
+        self.fileName = os.path.join(tempfile.gettempdir(), "TestTreePerf.FCStd")
+
+        doc = FreeCAD.newDocument("TestTreePerf")
+        groups = doc.addObjects("App::DocumentObjectGroup", ["Group"] * self.groups)
+        objects = doc.addObjects("App::DocumentObjectGroup", ["Object"] * self.groups * GroupSize)
+        for i, group in enumerate(groups):
+            group.Group = objects[i * GroupSize : (i + 1) * GroupSize]
+        self.objects = len(doc.Objects)
+        doc.saveAs(self.fileName)
+        FreeCAD.closeDocument(doc.Name)
+
+    def tearDown(self):
+        if os.path.exists(self.fileName):
+            os.remove(self.fileName)
+
+    def report(self, phase, start):
+        print(
+            json.dumps(
+                {
+                    "scenario": "groups",
+                    "objects": self.objects,
+                    "phase": phase,
+                    "ms": round((time.perf_counter() - start) * 1000.0, 3),
+                }
+            )
+        )
+
+    def findDocumentItem(self, doc):
+        mw = FreeCADGui.getMainWindow()
+        for tree in mw.findChildren(QtWidgets.QTreeWidget):
+            for i in range(tree.topLevelItemCount()):
+                item = tree.topLevelItem(i)
+                if item.text(0) == doc.Label:
+                    return item
+        return None
+
+    def testOpenAndExpand(self):
+        start = time.perf_counter()
+        doc = FreeCAD.openDocument(self.fileName)
+        docItem = None
+        while time.perf_counter() - start < Timeout:
+            docItem = docItem or self.findDocumentItem(doc)
+            if docItem and docItem.childCount() >= self.groups:
+                break
+            wait(1)
+        self.report("open", start)
+        self.assertIsNotNone(docItem, "Cannot find the document in the tree view")
+        self.assertEqual(docItem.childCount(), self.groups)
+
+        start = time.perf_counter()
+        for i in range(docItem.childCount()):
+            docItem.child(i).setExpanded(True)
+        FreeCADGui.updateGui()
+        self.report("expand", start)
+        self.assertEqual(docItem.child(0).childCount(), GroupSize)
+
+        start = time.perf_counter()
+        FreeCAD.closeDocument(doc.Name)
+        FreeCADGui.updateGui()
+        self.report("close", start)
@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+// Headless benchmark of the creation of many document objects.
+//
+// Creates the objects an importer or an exploded array would create and times, for object
+// creation one by one with Document::addObject and in bulk with Document::addObjects:
+//  - creating the objects, with Undo/Redo disabled and inside a transaction,
+//  - undoing the transaction,
+//  - closing the document.
+//
+// Usage: App_benchmark [--count N] [--type TYPE] [--repeat N] [--filter SCENARIO]
+//                      [--output FILE]
+
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <src/App/InitApplication.h>
+#include <src/Benchmark.h>
+
+namespace
+{
+
+using tests::benchmark::Harness;
+using tests::benchmark::Record;
+using tests::benchmark::timeMs;
+
+struct Options
+{
+    int count {100000};
+    std::string type {"App::FeatureTestPlacement"};
+};
+
+struct Scenario
+{
+    std::string name;
+    bool undo;
+    // Adds the given number of objects of the given type to the document
+    std::function<void(App::Document*, const std::string&, int)> create;
+};
+
+void addOneByOne(App::Document* doc, const std::string& type, int count)
+{
+    for (int i = 0; i < count; ++i) {
+        doc->addObject(type.c_str(), "Object");
+    }
+}
+
+void addInBulk(App::Document* doc, const std::string& type, int count)
+{
+    doc->addObjects(type.c_str(), static_cast<std::size_t>(count), "Object");
+}
+
+class Benchmark
+{
+public:
+    Benchmark(const Options& options, Harness& harness)
+        : options(options)
+        , harness(harness)
+    {}
+
+    bool run(const Scenario& scenario)
+    {
+        std::vector<double> create;
+        std::vector<double> undo;
+        std::vector<double> close;
+
+        for (int i = 0; i < harness.repeat(); ++i) {
+            std::string docName = App::GetApplication().getUniqueDocumentName("benchmark");
+            auto doc = App::GetApplication().newDocument(docName.c_str(), "benchmark");
+            doc->setUndoMode(scenario.undo ? 1 : 0);
+
+            create.push_back(timeMs([&]() {
+                if (scenario.undo) {
+                    doc->openTransaction("Create objects");
+                }
+                scenario.create(doc, options.type, options.count);
+                if (scenario.undo) {
+                    doc->commitTransaction();
+                }
+            }));
+            if (doc->countObjects() != options.count) {
+                std::cerr << "Cannot create objects of type " << options.type << "\n";
+                App::GetApplication().closeDocument(docName.c_str());
+                return false;
+            }
+            if (scenario.undo) {
+                undo.push_back(timeMs([&]() { doc->undo(); }));
+            }
+            close.push_back(
+                timeMs([&]() { App::GetApplication().closeDocument(docName.c_str()); })
+            );
+        }
+
+        report(scenario, "create", create);
+        if (scenario.undo) {
+            report(scenario, "undo", undo);
+        }
+        report(scenario, "close", close);
+        return true;
+    }
+
+private:
+    void report(const Scenario& scenario, const char* phase, const std::vector<double>& samples)
+    {
+        Record()
+            .add("scenario", scenario.name)
+            .add("type", options.type)
+            .add("objects", options.count)
+            .add("phase", phase)
+            .addSamples(samples)
+            .write(harness.out());
+    }
+
+    const Options& options;
+    Harness& harness;
+};
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    Options options;
+    Harness harness(3);
+    harness.addOption("--count", options.count);
+    harness.addOption("--type", options.type, "TYPE");
+    if (!harness.init(argc, argv)) {
+        return 1;
+    }
+
+    tests::initApplication();
+
+    const std::vector<Scenario> scenarios {
+        {"addObject", false, addOneByOne},
+        {"addObject_undo", true, addOneByOne},
+        {"addObjects", false, addInBulk},
+        {"addObjects_undo", true, addInBulk},
+    };
+
+    Benchmark benchmark(options, harness);
+    for (const auto& scenario : scenarios) {
+        if (!harness.selected(scenario.name)) {
+            continue;
+        }
+        if (!benchmark.run(scenario)) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -5,6 +5,7 @@
 
 #include "App/Application.h"
 #include "App/Document.h"
+#include "App/FeatureTest.h"
 #include "App/StringHasher.h"
 #include "Base/Writer.h"
 #include <src/App/InitApplication.h>
@@ -94,4 +95,151 @@ TEST_F(DocumentTest, getStringHasherGivesExpectedHasher)
     EXPECT_EQ(hasher, foundHasher);
 }
 
+TEST_F(DocumentTest, addObjectsReservesNamesAndSignalsOnce)
+{
+    // Arrange
+    doc()->addObject("App::FeatureTest", "Feature");
+    int newObject = 0;
+    std::size_t newObjects = 0;
+    auto connectNew = doc()->signalNewObject.connect([&](const App::DocumentObject&) {
+        ++newObject;
+    });
+    auto connectNews = doc()->signalNewObjects.connect(
+        [&](const std::vector<App::DocumentObject*>& objects) { newObjects += objects.size(); });
+
+    // Act
+    auto objects = doc()->addObjects("App::FeatureTest", 3, "Feature");
+
+    // Assert
+    ASSERT_EQ(objects.size(), 3);
+    EXPECT_STREQ(objects[0]->getNameInDocument(), "Feature001");
+    EXPECT_STREQ(objects[2]->getNameInDocument(), "Feature003");
+    EXPECT_EQ(objects[2]->Label.getStrValue(), "Feature003");
+    EXPECT_EQ(doc()->getActiveObject(), objects[2]);
+    EXPECT_EQ(newObject, 3);
+    EXPECT_EQ(newObjects, 3);
+    connectNew.disconnect();
+    connectNews.disconnect();
+}
+
+TEST_F(DocumentTest, addObjectsIsUndoneAtOnce)
+{
+    // Arrange
+    doc()->setUndoMode(1);
+    doc()->openTransaction("Add objects");
+
+    // Act
+    doc()->addObjects("App::FeatureTest", std::vector<std::string> {"First", "", "First"});
+    doc()->commitTransaction();
+
+    // Assert
+    EXPECT_NE(doc()->getObject("First"), nullptr);
+    EXPECT_NE(doc()->getObject("First001"), nullptr);
+    EXPECT_EQ(doc()->countObjects(), 3);
+
+    // Act
+    doc()->undo();
+
+    // Assert
+    EXPECT_EQ(doc()->countObjects(), 0);
+
+    // Act
+    doc()->redo();
+
+    // Assert
+    EXPECT_EQ(doc()->countObjects(), 3);
+    EXPECT_NE(doc()->getObject("First001"), nullptr);
+}
+
+TEST_F(DocumentTest, changeBatchCoalescesChangedSignals)
+{
+    // Arrange
+    auto feature = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest"));
+    int changedInteger = 0;
+    int changedFloat = 0;
+    auto connection = doc()->signalChangedObject.connect(
+        [&](const App::DocumentObject&, const App::Property& prop) {
+            changedInteger += &prop == &feature->Integer;
+            changedFloat += &prop == &feature->Float;
+        });
+
+    // Act
+    doc()->openChangeBatch();
+    doc()->openChangeBatch();
+    for (int i = 0; i < 10; ++i) {
+        feature->Integer.setValue(i);
+    }
+    feature->Float.setValue(1.5);
+    doc()->closeChangeBatch();
+    int changedInNestedBatch = changedInteger;
+    doc()->closeChangeBatch();
+
+    // Assert
+    EXPECT_EQ(changedInNestedBatch, 0);
+    EXPECT_EQ(changedInteger, 1);
+    EXPECT_EQ(changedFloat, 1);
+    EXPECT_FALSE(doc()->isChangeBatchOpen());
+
+    // Act: outside of a batch every change is signalled
+    feature->Integer.setValue(20);
+    feature->Integer.setValue(21);
+
+    // Assert
+    EXPECT_EQ(changedInteger, 3);
+    connection.disconnect();
+}
+
+TEST_F(DocumentTest, changeBatchSkipsRemovedObjects)
+{
+    // Arrange
+    auto feature = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest"));
+    std::string name = feature->getNameInDocument();
+    int changed = 0;
+    auto connection = doc()->signalChangedObject.connect(
+        [&](const App::DocumentObject&, const App::Property&) { ++changed; });
+
+    // Act
+    doc()->openChangeBatch();
+    feature->Integer.setValue(5);
+    doc()->removeObject(name.c_str());
+    doc()->closeChangeBatch();
+
+    // Assert
+    EXPECT_EQ(changed, 0);
+    connection.disconnect();
+}
+
+TEST_F(DocumentTest, recomputeFlushesChangeBatch)
+{
+    // Arrange: like a shape binder, the listener touches an object that follows another one
+    auto support = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest"));
+    auto binder = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest"));
+    doc()->recompute();
+    int changed = 0;
+    auto connection = doc()->signalChangedObject.connect(
+        [&](const App::DocumentObject& obj, const App::Property& prop) {
+            if (&obj == support && &prop == &support->Integer) {
+                ++changed;
+                binder->touch();
+            }
+        });
+
+    // Act
+    doc()->openChangeBatch();
+    support->Integer.setValue(5);
+    doc()->recompute();
+    int changedByRecompute = changed;
+    support->Integer.setValue(6);
+    int changedAfterRecompute = changed;
+    doc()->closeChangeBatch();
+
+    // Assert
+    EXPECT_EQ(changedByRecompute, 1);
+    EXPECT_FALSE(binder->isTouched());
+    EXPECT_EQ(changedAfterRecompute, 1);  // the batch is still open after the recompute
+    EXPECT_EQ(changed, 2);
+    EXPECT_TRUE(binder->isTouched());
+    connection.disconnect();
+}
+
 // NOLINTEND(readability-magic-numbers)
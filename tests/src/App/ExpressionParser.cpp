@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include "Base/Interpreter.h"
 #include "Base/Quantity.h"
 
 #include "App/Application.h"
@@ -10,6 +11,8 @@
 #include "App/DocumentObject.h"
 #include "App/Expression.h"
 #include "App/ExpressionParser.h"
+#include "App/PropertyStandard.h"
+#include "App/PropertyUnits.h"
 
 #include "src/App/InitApplication.h"
 
@@ -327,4 +330,107 @@ TEST_F(ExpressionParserTest, canParseProperties)
         << "PropertyQuantity on object";
 }
 
+TEST_F(ExpressionParserTest, nativeEvaluationMatchesPython)
+{
+    auto len = dynamic_cast<App::PropertyLength*>(
+        this_obj()->addDynamicProperty("App::PropertyLength", "Len"));
+    auto count = dynamic_cast<App::PropertyInteger*>(
+        this_obj()->addDynamicProperty("App::PropertyInteger", "Count"));
+    auto factor = dynamic_cast<App::PropertyFloat*>(
+        this_obj()->addDynamicProperty("App::PropertyFloat", "Factor"));
+    ASSERT_TRUE(len && count && factor);
+    len->setValue(12.5);
+    count->setValue(4);
+    factor->setValue(0.25);
+
+    for (const char* text : {"2 + 3",
+                             "7 / 2",
+                             "2 ^ 10",
+                             "2 ^ -1",
+                             "-3 * 1.5",
+                             "-(2 - 2)",
+                             "10 mm * 3",
+                             "40 mm / (2 cm)",
+                             "2 mm ^ 2",
+                             "pi * 2",
+                             "Len / 2 + 1 mm",
+                             "Count * 2 - 1",
+                             "Count * Factor",
+                             "sqrt(9 mm^2)",
+                             "atan2(1 mm, 1 mm)",
+                             "pow(2 mm, 3)",
+                             "hypot(3 mm, 4 mm, Len)",
+                             "round(Len / 1 mm)"}) {
+        const auto expression = parse(this_obj(), text);
+        Base::Quantity value;
+        Expression::NativeType type {};
+        EXPECT_TRUE(expression->getNativeValue(value, type)) << text;
+
+        boost::any native = expression->getValueAsAny();
+        boost::any python;
+        {
+            Base::PyGILStateLocker lock;
+            python = App::pyObjectToAny(expression->getPyValue());
+        }
+        ASSERT_TRUE(native.type() == python.type()) << text;
+        if (python.type() == typeid(Base::Quantity)) {
+            EXPECT_EQ(App::any_cast<Base::Quantity>(native),
+                      App::any_cast<Base::Quantity>(python))
+                << text;
+        }
+        else if (python.type() == typeid(double)) {
+            EXPECT_EQ(App::any_cast<double>(native), App::any_cast<double>(python)) << text;
+        }
+        else {
+            EXPECT_EQ(App::any_cast<long>(native), App::any_cast<long>(python)) << text;
+        }
+    }
+}
+
+TEST_F(ExpressionParserTest, nativeEvaluationFallsBackToPython)
+{
+    for (const char* text : {"True + 1",
+                             "(-8) ^ (1 / 3)",
+                             "Placement.Base.x",
+                             "1 / 0",
+                             "1 mm + 1",
+                             "2 > 1",
+                             "2 ^ 60",
+                             "vector(1, 2, 3)"}) {
+        const auto expression = parse(this_obj(), text);
+        Base::Quantity value;
+        Expression::NativeType type {};
+        EXPECT_FALSE(expression->getNativeValue(value, type)) << text;
+    }
+}
+
+TEST_F(ExpressionParserTest, resolveCacheFollowsRelabel)
+{
+    auto first = this_doc()->addObject("App::VarSet", "First");
+    auto second = this_doc()->addObject("App::VarSet", "Second");
+    for (auto [obj, width] : {std::pair {first, 1.0}, std::pair {second, 2.0}}) {
+        auto prop = dynamic_cast<App::PropertyLength*>(
+            obj->addDynamicProperty("App::PropertyLength", "Width"));
+        ASSERT_TRUE(prop);
+        prop->setValue(width);
+    }
+    first->Label.setValue("Params");
+    const auto expression = parse(this_obj(), "<<Params>>.Width");
+
+    App::ObjectIdentifier::resetResolveCacheStats();
+    EXPECT_THAT(expression->getValueAsAny(), IsQuantity(mm(1)));
+    EXPECT_THAT(expression->getValueAsAny(), IsQuantity(mm(1)));
+    EXPECT_GE(App::ObjectIdentifier::getResolveCacheStats().hits, 1U)
+        << "repeated evaluation reuses the label lookup";
+
+    first->Label.setValue("Old");
+    second->Label.setValue("Params");
+    EXPECT_THAT(expression->getValueAsAny(), IsQuantity(mm(2)))
+        << "relabeling invalidates the cached lookup";
+
+    this_doc()->removeObject(second->getNameInDocument());
+    EXPECT_THROW(expression->getValueAsAny(), Base::Exception)
+        << "deleting the object invalidates the cached lookup";
+}
+
 }  // namespace App::ExpressionParser::Test
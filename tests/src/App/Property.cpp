@@ -439,3 +439,166 @@ TEST_F(RenameProperty, redoRenameProperty)
     EXPECT_EQ(varSet->getDynamicPropertyByName("Variable"), nullptr);
     EXPECT_EQ(varSet->getDynamicPropertyByName("NewName"), prop);
 }
+
+class PropertyListUndo: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        _docName = App::GetApplication().getUniqueDocumentName("test");
+        _doc = App::GetApplication().newDocument(_docName.c_str(), "testUser");
+        _doc->setUndoMode(1);
+        auto varSet = freecad_cast<App::VarSet*>(_doc->addObject("App::VarSet", "VarSet"));
+        prop = freecad_cast<App::PropertyIntegerList*>(
+            varSet->addDynamicProperty("App::PropertyIntegerList", "Values", "Variables")
+        );
+        for (long i = 0; i < Size; ++i) {
+            values.push_back(i);
+        }
+        prop->setValues(values);
+    }
+
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(_docName.c_str());
+    }
+
+    const long Size = 1000;
+    std::vector<long> values;
+    App::PropertyIntegerList* prop {};
+    std::string _docName;
+    App::Document* _doc {};
+};
+
+// Tests whether changes of single elements are undone and redone
+TEST_F(PropertyListUndo, undoRedoSet1Value)
+{
+    // Act
+    _doc->openTransaction("Set values");
+    prop->set1Value(10, -1);
+    prop->set1Value(20, -2);
+    prop->set1Value(10, -3);
+    prop->set1Value(-1, -4);
+    _doc->commitTransaction();
+    auto changed = prop->getValues();
+
+    // Assert
+    ASSERT_EQ(changed.size(), Size + 1);
+    EXPECT_EQ(changed[10], -3);
+    EXPECT_EQ(changed[20], -2);
+    EXPECT_EQ(changed[Size], -4);
+
+    // Act
+    EXPECT_TRUE(_doc->undo());
+
+    // Assert
+    EXPECT_EQ(prop->getValues(), values);
+
+    // Act
+    EXPECT_TRUE(_doc->redo());
+
+    // Assert
+    EXPECT_EQ(prop->getValues(), changed);
+
+    // Act
+    EXPECT_TRUE(_doc->undo());
+
+    // Assert
+    EXPECT_EQ(prop->getValues(), values);
+}
+
+// Tests whether a change of the whole list after a change of single elements is undone
+TEST_F(PropertyListUndo, undoSet1ValueAndSetValues)
+{
+    // Act
+    _doc->openTransaction("Set values");
+    prop->set1Value(5, -1);
+    prop->setValues({1, 2, 3});
+    prop->set1Value(1, -2);
+    _doc->commitTransaction();
+
+    // Assert
+    EXPECT_EQ(prop->getValues(), (std::vector<long> {1, -2, 3}));
+
+    // Act
+    EXPECT_TRUE(_doc->undo());
+
+    // Assert
+    EXPECT_EQ(prop->getValues(), values);
+
+    // Act
+    EXPECT_TRUE(_doc->redo());
+
+    // Assert
+    EXPECT_EQ(prop->getValues(), (std::vector<long> {1, -2, 3}));
+}
+
+// Tests whether a list property changed and then removed in the same transaction is restored
+TEST_F(PropertyListUndo, undoSet1ValueOfRemovedProperty)
+{
+    // Arrange
+    auto container = prop->getContainer();
+
+    // Act
+    _doc->openTransaction("Set and remove values");
+    prop->set1Value(10, -1);
+    container->removeDynamicProperty("Values");
+    _doc->commitTransaction();
+
+    // Assert
+    EXPECT_EQ(container->getDynamicPropertyByName("Values"), nullptr);
+
+    // Act
+    EXPECT_TRUE(_doc->undo());
+    auto restored = freecad_cast<App::PropertyIntegerList*>(
+        container->getDynamicPropertyByName("Values")
+    );
+
+    // Assert
+    ASSERT_NE(restored, nullptr);
+    EXPECT_EQ(restored->getValues(), values);
+}
+
+// Tests whether a change of single elements is undone after undoing the removal of the property
+TEST_F(PropertyListUndo, undoSet1ValueBeforeRemoval)
+{
+    // Arrange
+    auto container = prop->getContainer();
+
+    // Act
+    _doc->openTransaction("Set values");
+    prop->set1Value(10, -1);
+    _doc->commitTransaction();
+    auto changed = prop->getValues();
+    _doc->openTransaction("Remove values");
+    container->removeDynamicProperty("Values");
+    _doc->commitTransaction();
+
+    // Assert
+    EXPECT_EQ(container->getDynamicPropertyByName("Values"), nullptr);
+
+    // Act
+    EXPECT_TRUE(_doc->undo());
+    auto restored = freecad_cast<App::PropertyIntegerList*>(
+        container->getDynamicPropertyByName("Values")
+    );
+
+    // Assert
+    ASSERT_NE(restored, nullptr);
+    EXPECT_EQ(restored->getValues(), changed);
+
+    // Act
+    EXPECT_TRUE(_doc->undo());
+    restored = freecad_cast<App::PropertyIntegerList*>(
+        container->getDynamicPropertyByName("Values")
+    );
+
+    // Assert
+    ASSERT_NE(restored, nullptr);
+    EXPECT_EQ(restored->getValues(), values);
+}
@@ -0,0 +1,386 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+// Headless benchmark of ray picking on tessellated shapes.
+//
+// Tessellates a sphere like the shape nodes of the 3D view hold it, casts rays from a viewpoint
+// through it like preselection does on mouse moves, and times, for the triangles and for the
+// edges of the tessellation:
+//  - testing every primitive, which is what picking by generated primitives does,
+//  - building a Base::BoundBoxTree over the primitives,
+//  - testing only the primitives whose box is cut by the ray.
+//
+// Both ways must pick the same primitives, the benchmark fails otherwise.
+//
+// Usage: Base_benchmark [--triangles N] [--rays N] [--repeat N] [--filter SCENARIO]
+//                       [--output FILE]
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <numbers>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <Base/BoundBoxTree.h>
+#include <Base/Vector3D.h>
+#include <src/Benchmark.h>
+
+namespace
+{
+
+using tests::benchmark::Harness;
+using tests::benchmark::Record;
+using tests::benchmark::timeMs;
+
+struct Options
+{
+    int triangles {1000000};
+    int rays {100};
+};
+
+struct Ray
+{
+    Base::Vector3f base;
+    Base::Vector3f dir;
+};
+
+struct Hit
+{
+    float distance {std::numeric_limits<float>::max()};
+    long index {-1};
+
+    void update(float dist, long idx)
+    {
+        // break ties by index to pick the same primitive whatever the test order is
+        if (dist < distance || (dist == distance && idx < index)) {
+            distance = dist;
+            index = idx;
+        }
+    }
+};
+
+// A UV sphere with its triangles and the segments of its meridians and parallels
+struct Tessellation
+{
+    std::vector<Base::Vector3f> points;
+    std::vector<std::uint32_t> triangles;
+    std::vector<std::uint32_t> segments;
+
+    explicit Tessellation(int numTriangles)
+    {
+        int slices = std::max(3, static_cast<int>(std::sqrt(numTriangles / 2.0)));
+        int stacks = std::max(2, numTriangles / (2 * slices));
+        for (int i = 0; i <= stacks; ++i) {
+            double theta = std::numbers::pi * i / stacks;
+            for (int j = 0; j < slices; ++j) {
+                double phi = 2.0 * std::numbers::pi * j / slices;
+                points.emplace_back(
+                    static_cast<float>(std::sin(theta) * std::cos(phi)),
+                    static_cast<float>(std::sin(theta) * std::sin(phi)),
+                    static_cast<float>(std::cos(theta))
+                );
+            }
+        }
+        auto vertex = [slices](int i, int j) {
+            return static_cast<std::uint32_t>(i * slices + (j % slices));
+        };
+        for (int i = 0; i < stacks; ++i) {
+            for (int j = 0; j < slices; ++j) {
+                std::uint32_t v00 = vertex(i, j);
+                std::uint32_t v01 = vertex(i, j + 1);
+                std::uint32_t v10 = vertex(i + 1, j);
+                std::uint32_t v11 = vertex(i + 1, j + 1);
+                triangles.insert(triangles.end(), {v00, v10, v11, v00, v11, v01});
+                segments.insert(segments.end(), {v00, v10, v00, v01});
+            }
+        }
+    }
+
+    std::size_t countTriangles() const
+    {
+        return triangles.size() / 3;
+    }
+
+    std::size_t countSegments() const
+    {
+        return segments.size() / 2;
+    }
+};
+
+// Möller-Trumbore, returns the distance along the ray or a negative value if not hit
+float intersectTriangle(
+    const Ray& ray,
+    const Base::Vector3f& v0,
+    const Base::Vector3f& v1,
+    const Base::Vector3f& v2
+)
+{
+    const float epsilon = 1e-9F;
+    Base::Vector3f edge1 = v1 - v0;
+    Base::Vector3f edge2 = v2 - v0;
+    Base::Vector3f pvec = ray.dir % edge2;
+    float det = edge1 * pvec;
+    if (std::fabs(det) < epsilon) {
+        return -1.0F;
+    }
+    float invDet = 1.0F / det;
+    Base::Vector3f tvec = ray.base - v0;
+    float u = (tvec * pvec) * invDet;
+    if (u < 0.0F || u > 1.0F) {
+        return -1.0F;
+    }
+    Base::Vector3f qvec = tvec % edge1;
+    float v = (ray.dir * qvec) * invDet;
+    if (v < 0.0F || u + v > 1.0F) {
+        return -1.0F;
+    }
+    return (edge2 * qvec) * invDet;
+}
+
+// Returns the distance along the ray of the point closest to the segment if the segment is
+// within the pick radius, or a negative value otherwise
+float intersectSegment(
+    const Ray& ray,
+    const Base::Vector3f& p0,
+    const Base::Vector3f& p1,
+    float radius
+)
+{
+    Base::Vector3f u = ray.dir;
+    Base::Vector3f v = p1 - p0;
+    Base::Vector3f w = ray.base - p0;
+    float a = u * u;
+    float b = u * v;
+    float c = v * v;
+    float d = u * w;
+    float e = v * w;
+    float denom = a * c - b * b;
+    float s = denom > 1e-12F ? std::clamp((a * e - b * d) / denom, 0.0F, 1.0F) : 0.0F;
+    float t = std::max(0.0F, (b * s - d) / a);
+    Base::Vector3f closest = ray.base + u * t - (p0 + v * s);
+    if (closest.Length() > radius) {
+        return -1.0F;
+    }
+    return t;
+}
+
+std::vector<Base::BoundBox3f> triangleBoxes(const Tessellation& mesh)
+{
+    std::vector<Base::BoundBox3f> boxes;
+    boxes.reserve(mesh.countTriangles());
+    for (std::size_t i = 0; i < mesh.triangles.size(); i += 3) {
+        Base::BoundBox3f box;
+        box.Add(mesh.points[mesh.triangles[i]]);
+        box.Add(mesh.points[mesh.triangles[i + 1]]);
+        box.Add(mesh.points[mesh.triangles[i + 2]]);
+        boxes.push_back(box);
+    }
+    return boxes;
+}
+
+std::vector<Base::BoundBox3f> segmentBoxes(const Tessellation& mesh)
+{
+    std::vector<Base::BoundBox3f> boxes;
+    boxes.reserve(mesh.countSegments());
+    for (std::size_t i = 0; i < mesh.segments.size(); i += 2) {
+        Base::BoundBox3f box;
+        box.Add(mesh.points[mesh.segments[i]]);
+        box.Add(mesh.points[mesh.segments[i + 1]]);
+        boxes.push_back(box);
+    }
+    return boxes;
+}
+
+struct Scene
+{
+    Tessellation mesh;
+    std::vector<Ray> rays;
+    // the pick radius for edges, a few pixels in a typical view
+    float radius;
+
+    Scene(int numTriangles, int numRays)
+        : mesh(numTriangles)
+        , radius(0.002F)
+    {
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<float> pos(-1.2F, 1.2F);
+        Base::Vector3f eye(0.0F, 0.0F, 5.0F);
+        for (int i = 0; i < numRays; ++i) {
+            Base::Vector3f target(pos(gen), pos(gen), 0.0F);
+            Base::Vector3f dir = target - eye;
+            dir.Normalize();
+            rays.push_back({eye, dir});
+        }
+    }
+
+    void pickTriangle(const Ray& ray, std::size_t index, Hit& hit) const
+    {
+        const auto& p = mesh.points;
+        const auto* tri = &mesh.triangles[3 * index];
+        float dist = intersectTriangle(ray, p[tri[0]], p[tri[1]], p[tri[2]]);
+        if (dist >= 0.0F) {
+            hit.update(dist, static_cast<long>(index));
+        }
+    }
+
+    void pickSegment(const Ray& ray, std::size_t index, Hit& hit) const
+    {
+        const auto& p = mesh.points;
+        const auto* seg = &mesh.segments[2 * index];
+        float dist = intersectSegment(ray, p[seg[0]], p[seg[1]], radius);
+        if (dist >= 0.0F) {
+            hit.update(dist, static_cast<long>(index));
+        }
+    }
+};
+
+struct Scenario
+{
+    std::string name;
+    bool edges;
+    bool tree;
+};
+
+class Benchmark
+{
+public:
+    Benchmark(const Scene& scene, Harness& harness)
+        : scene(scene)
+        , harness(harness)
+    {}
+
+    /// Runs the scenario and returns the picked primitive of each ray.
+    std::vector<long> run(const Scenario& scenario)
+    {
+        std::vector<double> build;
+        std::vector<double> pick;
+        std::vector<long> hits(scene.rays.size(), -1);
+        std::size_t primitives = scenario.edges ? scene.mesh.countSegments()
+                                                : scene.mesh.countTriangles();
+
+        auto test = [&](const Ray& ray, std::size_t index, Hit& hit) {
+            if (scenario.edges) {
+                scene.pickSegment(ray, index, hit);
+            }
+            else {
+                scene.pickTriangle(ray, index, hit);
+            }
+        };
+
+        for (int i = 0; i < harness.repeat(); ++i) {
+            if (!scenario.tree) {
+                pick.push_back(timeMs([&]() {
+                    for (std::size_t r = 0; r < scene.rays.size(); ++r) {
+                        Hit hit;
+                        for (std::size_t index = 0; index < primitives; ++index) {
+                            test(scene.rays[r], index, hit);
+                        }
+                        hits[r] = hit.index;
+                    }
+                }));
+                continue;
+            }
+
+            Base::BoundBoxTree tree;
+            build.push_back(timeMs([&]() {
+                tree = Base::BoundBoxTree(scenario.edges ? segmentBoxes(scene.mesh)
+                                                         : triangleBoxes(scene.mesh));
+            }));
+            float tolerance = scenario.edges ? scene.radius : 0.0F;
+            pick.push_back(timeMs([&]() {
+                for (std::size_t r = 0; r < scene.rays.size(); ++r) {
+                    const Ray& ray = scene.rays[r];
+                    Hit hit;
+                    tree.traverseRay(
+                        ray.base,
+                        ray.dir,
+                        [&](std::size_t index) {
+                            test(ray, index, hit);
+                            return true;
+                        },
+                        tolerance
+                    );
+                    hits[r] = hit.index;
+                }
+            }));
+        }
+
+        long hitCount = std::count_if(hits.begin(), hits.end(), [](long index) {
+            return index >= 0;
+        });
+        if (scenario.tree) {
+            report(scenario, primitives, hitCount, "build", build);
+        }
+        report(scenario, primitives, hitCount, "pick", pick);
+        return hits;
+    }
+
+private:
+    void report(
+        const Scenario& scenario,
+        std::size_t primitives,
+        long hits,
+        const char* phase,
+        const std::vector<double>& samples
+    )
+    {
+        Record()
+            .add("scenario", scenario.name)
+            .add("primitives", primitives)
+            .add("rays", scene.rays.size())
+            .add("hits", hits)
+            .add("phase", phase)
+            .addSamples(samples)
+            .write(harness.out());
+    }
+
+    const Scene& scene;
+    Harness& harness;
+};
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    Options options;
+    Harness harness(3);
+    harness.addOption("--triangles", options.triangles, 8);
+    harness.addOption("--rays", options.rays);
+    if (!harness.init(argc, argv)) {
+        return 1;
+    }
+
+    // the linear scenario of a kind runs first, the tree scenario is checked against it
+    const std::vector<Scenario> scenarios {
+        {"faces_linear", false, false},
+        {"faces_tree", false, true},
+        {"edges_linear", true, false},
+        {"edges_tree", true, true},
+    };
+
+    Scene scene(options.triangles, options.rays);
+    Benchmark benchmark(scene, harness);
+    std::vector<long> expected;
+    for (const auto& scenario : scenarios) {
+        if (!harness.selected(scenario.name)) {
+            continue;
+        }
+        std::vector<long> hits = benchmark.run(scenario);
+        if (!scenario.tree) {
+            expected = hits;
+        }
+        else if (!expected.empty() && hits != expected) {
+            std::cerr << "The tree picks other primitives than the linear search in "
+                      << scenario.name << "\n";
+            return 1;
+        }
+        if (scenario.tree) {
+            expected.clear();
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+#include <Base/BoundBoxTree.h>
+
+class BoundBoxTreeTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a grid of unit cubes in the xy plane
+        for (int i = 0; i < 50; ++i) {
+            for (int j = 0; j < 40; ++j) {
+                auto x = static_cast<float>(i);
+                auto y = static_cast<float>(j);
+                boxes.emplace_back(x, y, 0.0F, x + 1.0F, y + 1.0F, 1.0F);
+            }
+        }
+    }
+
+    std::vector<std::size_t> candidates(
+        const Base::BoundBoxTree& tree,
+        const Base::Vector3f& base,
+        const Base::Vector3f& dir
+    ) const
+    {
+        std::vector<std::size_t> result;
+        tree.traverseRay(base, dir, [&result](std::size_t index) {
+            result.push_back(index);
+            return true;
+        });
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    std::vector<std::size_t> linearCandidates(
+        const Base::Vector3f& base,
+        const Base::Vector3f& dir
+    ) const
+    {
+        std::vector<std::size_t> result;
+        for (std::size_t i = 0; i < boxes.size(); ++i) {
+            if (Base::BoundBoxTree::isCutByRay(boxes[i], base, dir)) {
+                result.push_back(i);
+            }
+        }
+        return result;
+    }
+
+    std::vector<Base::BoundBox3f> boxes;
+};
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+TEST_F(BoundBoxTreeTest, emptyTree)
+{
+    Base::BoundBoxTree tree;
+    EXPECT_TRUE(tree.empty());
+    EXPECT_EQ(tree.size(), 0);
+    EXPECT_TRUE(candidates(tree, Base::Vector3f(0, 0, 0), Base::Vector3f(0, 0, 1)).empty());
+}
+
+TEST_F(BoundBoxTreeTest, boundBoxOfAllPrimitives)
+{
+    Base::BoundBoxTree tree(boxes);
+    EXPECT_EQ(tree.size(), boxes.size());
+    Base::BoundBox3f box = tree.getBoundBox();
+    EXPECT_EQ(box.GetMinimum(), Base::Vector3f(0, 0, 0));
+    EXPECT_EQ(box.GetMaximum(), Base::Vector3f(50, 40, 1));
+}
+
+TEST_F(BoundBoxTreeTest, rayCutsBox)
+{
+    Base::BoundBox3f box(0, 0, 0, 1, 1, 1);
+    Base::Vector3f above(0.5F, 0.5F, 5);
+    Base::Vector3f inside(0.5F, 0.5F, 0.5F);
+    Base::Vector3f aside(2, 0.5F, 5);
+    Base::Vector3f down(0, 0, -1);
+    Base::Vector3f up(0, 0, 1);
+    EXPECT_TRUE(Base::BoundBoxTree::isCutByRay(box, above, down));
+    EXPECT_TRUE(Base::BoundBoxTree::isCutByRay(box, inside, Base::Vector3f(1, 1, 1)));
+    // the ray starts behind the box
+    EXPECT_FALSE(Base::BoundBoxTree::isCutByRay(box, above, up));
+    // the ray passes the box
+    EXPECT_FALSE(Base::BoundBoxTree::isCutByRay(box, aside, down));
+    EXPECT_TRUE(Base::BoundBoxTree::isCutByRay(box, aside, down, 1.5F));
+}
+
+TEST_F(BoundBoxTreeTest, verticalRayHitsOneCell)
+{
+    Base::BoundBoxTree tree(boxes);
+    auto result = candidates(tree, Base::Vector3f(10.5F, 20.5F, 5), Base::Vector3f(0, 0, -1));
+    ASSERT_EQ(result.size(), 1);
+    EXPECT_EQ(result.front(), 10 * 40 + 20);
+}
+
+TEST_F(BoundBoxTreeTest, sameCandidatesAsLinearSearch)
+{
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> pos(-10.0F, 60.0F);
+    std::uniform_real_distribution<float> dir(-1.0F, 1.0F);
+
+    for (std::size_t leafSize : {1, 4, 16}) {
+        Base::BoundBoxTree tree(boxes, leafSize);
+        for (int i = 0; i < 100; ++i) {
+            Base::Vector3f base(pos(gen), pos(gen), 10.0F);
+            Base::Vector3f direction(dir(gen), dir(gen), -1.0F);
+            EXPECT_EQ(candidates(tree, base, direction), linearCandidates(base, direction));
+        }
+    }
+}
+
+TEST_F(BoundBoxTreeTest, traversalStopsWhenVisitFails)
+{
+    Base::BoundBoxTree tree(boxes);
+    int count = 0;
+    tree.traverse(
+        [](const Base::BoundBox3f&) { return true; },
+        [&count](std::size_t) { return ++count < 3; }
+    );
+    EXPECT_EQ(count, 3);
+}
+// NOLINTEND(cppcoreguidelines-*,readability-*)
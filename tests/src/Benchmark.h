@@ -0,0 +1,197 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+// Helpers shared by the headless benchmarks in the Benchmark directories of the tests.
+//
+// Every measurement is printed as a JSON object on a line of its own, so that the results of
+// different builds can be compared with standard tools.
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace tests::benchmark
+{
+
+/// The median of the samples, or 0 if there are none
+inline double median(std::vector<double> samples)
+{
+    if (samples.empty()) {
+        return 0.0;
+    }
+    std::sort(samples.begin(), samples.end());
+    return samples[samples.size() / 2];
+}
+
+/// The wall clock time \a func takes, in milliseconds
+template<typename Func>
+double timeMs(Func&& func)
+{
+    auto start = std::chrono::steady_clock::now();
+    func();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+/**
+ * The options every benchmark has, i.e. the number of repetitions, a filter on the scenario
+ * names and the output file, plus the options of the benchmark itself. All options are given
+ * as "--name value" on the command line.
+ */
+class Harness
+{
+public:
+    explicit Harness(int repeat)
+        : repetitions(repeat)
+    {}
+
+    /// Adds the option \a name setting \a value to an integer of at least \a minimum
+    void addOption(const char* name, int& value, int minimum = 1)
+    {
+        options.emplace_back(name, "N", [&value, minimum](const std::string& arg) {
+            value = std::max(minimum, std::stoi(arg));
+        });
+    }
+
+    /// Adds the option \a name setting \a value, \a placeholder names the value in the usage
+    void addOption(const char* name, std::string& value, const char* placeholder)
+    {
+        options.emplace_back(name, placeholder, [&value](const std::string& arg) {
+            value = arg;
+        });
+    }
+
+    /// Parses the command line and opens the output. Prints the reason and returns false on
+    /// failure.
+    bool init(int argc, char** argv)
+    {
+        addOption("--repeat", repetitions);
+        addOption("--filter", filter, "SCENARIO");
+        addOption("--output", output, "FILE");
+        if (!parse(argc, argv)) {
+            std::cerr << "Usage: " << argv[0];
+            for (const auto& [name, placeholder, set] : options) {
+                std::cerr << " [" << name << " " << placeholder << "]";
+            }
+            std::cerr << "\n";
+            return false;
+        }
+        if (!output.empty()) {
+            file.open(output);
+            if (!file) {
+                std::cerr << "Cannot write to " << output << "\n";
+                return false;
+            }
+        }
+        return true;
+    }
+
+    int repeat() const
+    {
+        return repetitions;
+    }
+
+    /// Whether the scenario \a name is selected by the filter
+    bool selected(const std::string& name) const
+    {
+        return filter.empty() || name.find(filter) != std::string::npos;
+    }
+
+    /// The stream the measurements are written to
+    std::ostream& out()
+    {
+        return file.is_open() ? file : std::cout;
+    }
+
+private:
+    bool parse(int argc, char** argv)
+    {
+        for (int i = 1; i < argc; ++i) {
+            std::string name = argv[i];
+            auto it = std::find_if(options.begin(), options.end(), [&name](const auto& option) {
+                return std::get<0>(option) == name;
+            });
+            if (it == options.end() || i + 1 >= argc) {
+                return false;
+            }
+            try {
+                std::get<2>(*it)(argv[++i]);
+            }
+            catch (const std::logic_error&) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    using Option = std::tuple<std::string, std::string, std::function<void(const std::string&)>>;
+    std::vector<Option> options;
+    int repetitions;
+    std::string filter;
+    std::string output;
+    std::ofstream file;
+};
+
+/// One measurement, written as a JSON object with the fields in the order they are added
+class Record
+{
+public:
+    Record& add(const char* key, const std::string& value)
+    {
+        next(key) << "\"" << value << "\"";
+        return *this;
+    }
+
+    Record& add(const char* key, const char* value)
+    {
+        return add(key, std::string(value));
+    }
+
+    template<typename T>
+        requires std::is_arithmetic_v<T>
+    Record& add(const char* key, T value)
+    {
+        next(key) << value;
+        return *this;
+    }
+
+    /// Adds the number of samples and their median, minimum and maximum in milliseconds
+    Record& addSamples(const std::vector<double>& samples)
+    {
+        double minimum = samples.empty() ? 0.0 : *std::ranges::min_element(samples);
+        double maximum = samples.empty() ? 0.0 : *std::ranges::max_element(samples);
+        return add("samples", samples.size())
+            .add("median_ms", median(samples))
+            .add("min_ms", minimum)
+            .add("max_ms", maximum);
+    }
+
+    void write(std::ostream& out) const
+    {
+        out << "{" << line.str() << "}" << std::endl;
+    }
+
+private:
+    std::ostringstream& next(const char* key)
+    {
+        if (line.tellp() > 0) {
+            line << ",";
+        }
+        line << "\"" << key << "\":";
+        return line;
+    }
+
+    std::ostringstream line;
+};
+
+}  // namespace tests::benchmark
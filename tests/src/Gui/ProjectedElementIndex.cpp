@@ -0,0 +1,171 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <Base/Matrix.h>
+#include <Base/Tools2D.h>
+#include <Base/ViewProj.h>
+#include <Gui/Selection/ProjectedElementIndex.h>
+
+class ProjectedElementIndexTest: public ::testing::Test
+{
+protected:
+    static constexpr int Cells = 10;
+
+    // a grid of unit squares in the xy plane, each one a face of two triangles
+    Gui::ProjectedElementIndex makeFaces() const
+    {
+        std::vector<Base::Vector3f> points;
+        for (int i = 0; i <= Cells; ++i) {
+            for (int j = 0; j <= Cells; ++j) {
+                points.emplace_back(static_cast<float>(i), static_cast<float>(j), 0.0F);
+            }
+        }
+
+        using Primitive = Gui::ProjectedElementIndex::Primitive;
+        Gui::ProjectedElementIndex index("Face", Primitive::Triangles, points);
+        for (int i = 0; i < Cells; ++i) {
+            for (int j = 0; j < Cells; ++j) {
+                std::int32_t p0 = i * (Cells + 1) + j;
+                std::int32_t p1 = p0 + Cells + 1;
+                std::vector<std::int32_t> corners {p0, p1, p1 + 1, p0, p1 + 1, p0 + 1};
+                index.addElement(corners.data(), corners.size());
+            }
+        }
+        return index;
+    }
+
+    // the names the geometry of the squares selects when tested one by one
+    std::vector<std::string> selectSquares(const Base::Polygon2d& polygon, bool center) const
+    {
+        std::vector<std::string> names;
+        for (int i = 0; i < Cells; ++i) {
+            for (int j = 0; j < Cells; ++j) {
+                double x = i;
+                double y = j;
+                Base::Polygon2d loop;
+                loop.Add(Base::Vector2d(x, y));
+                loop.Add(Base::Vector2d(x + 1, y));
+                loop.Add(Base::Vector2d(x + 1, y + 1));
+                loop.Add(Base::Vector2d(x, y + 1));
+                if (!polygon.Intersect(loop)) {
+                    continue;
+                }
+                if (center && !polygon.Contains(loop.CalcBoundBox().GetCenter())) {
+                    continue;
+                }
+                names.push_back("Face" + std::to_string(i * Cells + j + 1));
+            }
+        }
+        return names;
+    }
+
+    static Base::Polygon2d makeBox(double minX, double minY, double maxX, double maxY)
+    {
+        Base::Polygon2d polygon;
+        polygon.Add(Base::Vector2d(minX, minY));
+        polygon.Add(Base::Vector2d(minX, maxY));
+        polygon.Add(Base::Vector2d(maxX, maxY));
+        polygon.Add(Base::Vector2d(maxX, minY));
+        return polygon;
+    }
+
+    Base::ViewOrthoProjMatrix proj {Base::Matrix4D()};
+    Base::Matrix4D mat;
+};
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+TEST_F(ProjectedElementIndexTest, emptyIndex)
+{
+    Gui::ProjectedElementIndex index;
+    EXPECT_TRUE(index.empty());
+    EXPECT_TRUE(index.select(proj, mat, makeBox(0, 0, 1, 1), false).empty());
+}
+
+TEST_F(ProjectedElementIndexTest, boxSelectsFaces)
+{
+    auto index = makeFaces();
+    EXPECT_EQ(index.size(), Cells * Cells);
+
+    auto crossing = index.select(proj, mat, makeBox(2.6, 2.6, 5.4, 5.4), false);
+    EXPECT_EQ(crossing.size(), 16);
+    auto centered = index.select(proj, mat, makeBox(2.6, 2.6, 5.4, 5.4), true);
+    std::vector<std::string> expected {"Face34", "Face35", "Face44", "Face45"};
+    EXPECT_EQ(centered, expected);
+}
+
+TEST_F(ProjectedElementIndexTest, boxInsideFace)
+{
+    auto index = makeFaces();
+    std::vector<std::string> expected {"Face1"};
+    EXPECT_EQ(index.select(proj, mat, makeBox(0.4, 0.4, 0.6, 0.6), false), expected);
+    EXPECT_EQ(index.select(proj, mat, makeBox(0.4, 0.4, 0.6, 0.6), true), expected);
+}
+
+TEST_F(ProjectedElementIndexTest, transformedFaces)
+{
+    auto index = makeFaces();
+    Base::Matrix4D move;
+    move.move(Base::Vector3d(-5, -5, 0));
+    std::vector<std::string> expected {"Face1"};
+    EXPECT_EQ(index.select(proj, move, makeBox(-4.9, -4.9, -4.1, -4.1), true), expected);
+}
+
+TEST_F(ProjectedElementIndexTest, sameFacesAsGeometry)
+{
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> pos(-1.0, Cells + 1.0);
+    std::uniform_real_distribution<double> radius(0.5, 4.0);
+    auto index = makeFaces();
+
+    for (int i = 0; i < 50; ++i) {
+        // a star shaped lasso
+        Base::Polygon2d polygon;
+        Base::Vector2d origin(pos(gen), pos(gen));
+        for (int j = 0; j < 40; ++j) {
+            double angle = 2.0 * M_PI * j / 40;
+            double r = radius(gen);
+            polygon.Add(
+                Base::Vector2d(origin.x + r * std::cos(angle), origin.y + r * std::sin(angle))
+            );
+        }
+        for (bool center : {false, true}) {
+            EXPECT_EQ(index.select(proj, mat, polygon, center), selectSquares(polygon, center));
+        }
+    }
+}
+
+TEST_F(ProjectedElementIndexTest, edgesAndVertexes)
+{
+    std::vector<Base::Vector3f> points {
+        Base::Vector3f(0, 0, 0),
+        Base::Vector3f(1, 0, 0),
+        Base::Vector3f(2, 0, 0),
+        Base::Vector3f(2, 1, 0),
+    };
+
+    using Primitive = Gui::ProjectedElementIndex::Primitive;
+    Gui::ProjectedElementIndex edges("Edge", Primitive::Polylines, points);
+    std::vector<std::int32_t> edge1 {0, 1};
+    std::vector<std::int32_t> edge2 {1, 2, 3};
+    edges.addElement(edge1.data(), edge1.size());
+    edges.addElement(edge2.data(), edge2.size());
+    std::vector<std::string> edge {"Edge2"};
+    EXPECT_EQ(edges.select(proj, mat, makeBox(1.5, -0.5, 2.5, 0.5), false), edge);
+    // the box cuts the first edge without containing a point of it
+    std::vector<std::string> both {"Edge1", "Edge2"};
+    EXPECT_EQ(edges.select(proj, mat, makeBox(0.4, -0.5, 1.5, 0.5), false), both);
+
+    Gui::ProjectedElementIndex vertexes("Vertex", Primitive::Points, points);
+    for (std::int32_t i = 0; i < 4; ++i) {
+        vertexes.addElement(&i, 1);
+    }
+    std::vector<std::string> vertex {"Vertex3", "Vertex4"};
+    EXPECT_EQ(vertexes.select(proj, mat, makeBox(1.5, -0.5, 2.5, 1.5), true), vertex);
+}
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,85 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <Mod/Mesh/App/MeshProperties.h>
+
+#include <src/App/InitApplication.h>
+
+class PropertyMeshKernelTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        MeshCore::MeshKernel kernel;
+        kernel.AddFacet(MeshCore::MeshGeomFacet(p1, p2, p3));
+        prop.setValue(kernel);
+    }
+
+    void addFacet(Mesh::PropertyMeshKernel& mesh) const
+    {
+        Base::Vector3f p4 {1, 1, 0};
+        mesh.startEditing()->addFacet(MeshCore::MeshGeomFacet(p3, p2, p4));
+        mesh.finishEditing();
+    }
+
+    Base::Vector3f p1 {0, 0, 0};
+    Base::Vector3f p2 {1, 0, 0};
+    Base::Vector3f p3 {0, 1, 0};
+    Mesh::PropertyMeshKernel prop;
+};
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+TEST_F(PropertyMeshKernelTest, copySharesTheMesh)
+{
+    std::unique_ptr<App::Property> copy(prop.Copy());
+    auto meshCopy = static_cast<Mesh::PropertyMeshKernel*>(copy.get());
+
+    EXPECT_EQ(meshCopy->getValuePtr(), prop.getValuePtr());
+}
+
+TEST_F(PropertyMeshKernelTest, editingDetachesTheMesh)
+{
+    std::unique_ptr<App::Property> copy(prop.Copy());
+    auto meshCopy = static_cast<Mesh::PropertyMeshKernel*>(copy.get());
+
+    addFacet(prop);
+
+    EXPECT_NE(meshCopy->getValuePtr(), prop.getValuePtr());
+    EXPECT_EQ(meshCopy->getValue().countFacets(), 1);
+    EXPECT_EQ(prop.getValue().countFacets(), 2);
+}
+
+TEST_F(PropertyMeshKernelTest, editingAnUnsharedMeshKeepsIt)
+{
+    const Mesh::MeshObject* mesh = prop.getValuePtr();
+    {
+        std::unique_ptr<App::Property> copy(prop.Copy());
+    }
+
+    addFacet(prop);
+
+    EXPECT_EQ(prop.getValuePtr(), mesh);
+    EXPECT_EQ(prop.getValue().countFacets(), 2);
+}
+
+TEST_F(PropertyMeshKernelTest, pasteRestoresTheMesh)
+{
+    std::unique_ptr<App::Property> copy(prop.Copy());
+    auto meshCopy = static_cast<Mesh::PropertyMeshKernel*>(copy.get());
+    addFacet(prop);
+
+    prop.Paste(*copy);
+    EXPECT_EQ(prop.getValue().countFacets(), 1);
+
+    // the restored mesh is shared again, editing it keeps the copy
+    addFacet(prop);
+    EXPECT_EQ(meshCopy->getValue().countFacets(), 1);
+    EXPECT_EQ(prop.getValue().countFacets(), 2);
+}
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -2,6 +2,9 @@
 
 #include <gtest/gtest.h>
 
+#include <map>
+#include <string>
+
 #include "Mod/Part/App/FeaturePartFuse.h"
 #include <src/App/InitApplication.h>
 #include "Mod/Part/App/FeatureCompound.h"
@@ -27,6 +30,20 @@ protected:
     void TearDown() override
     {}
 
+    // The centers of the faces and edges of a shape by their mapped names
+    static std::map<std::string, Base::Vector3d> elementCenters(const Part::TopoShape& shape)
+    {
+        std::map<std::string, Base::Vector3d> centers;
+        for (const auto& element : shape.getElementMap()) {
+            std::string type = element.index.getType();
+            if (type == "Face" || type == "Edge") {
+                Part::TopoShape sub = shape.getSubTopoShape(element.index.toString().c_str());
+                centers[element.name.toString()] = sub.getBoundBox().GetCenter();
+            }
+        }
+        return centers;
+    }
+
     Part::Fuse* _fuse = nullptr;            // NOLINT Can't be private in a test framework
     Part::MultiFuse* _multiFuse = nullptr;  // NOLINT Can't be private in a test framework
 };
@@ -112,6 +129,59 @@ TEST_F(FeaturePartFuseTest, testRecursiveCompound)
     EXPECT_DOUBLE_EQ(bb.MaxZ, 3.0);
 }
 
+TEST_F(FeaturePartFuseTest, testTreeReduction)
+{
+    // Arrange
+    _multiFuse->Shapes.setValues({_boxes[0], _boxes[1], _boxes[2]});
+    _multiFuse->execute();
+    double standardVolume = PartTestHelpers::getVolume(_multiFuse->Shape.getValue());
+    _multiFuse->Mode.setValue("TreeReduction");
+
+    // Act
+    _multiFuse->execute();
+    Part::TopoShape ts = _multiFuse->Shape.getValue();
+    double volume = PartTestHelpers::getVolume(ts.getShape());
+    Base::BoundBox3d bb = ts.getBoundBox();
+    auto mapSize = _multiFuse->Shape.getShape().getElementMapSize();
+    _multiFuse->execute();
+
+    // Assert
+    EXPECT_DOUBLE_EQ(volume, 15.0);
+    EXPECT_DOUBLE_EQ(volume, standardVolume);
+    EXPECT_EQ(_multiFuse->History.getSize(), 3);
+    // Recomputing yields the same element names
+    EXPECT_EQ(_multiFuse->Shape.getShape().getElementMapSize(), mapSize);
+    // double check using bounds:
+    EXPECT_DOUBLE_EQ(bb.MinX, 0.0);
+    EXPECT_DOUBLE_EQ(bb.MinY, 0.0);
+    EXPECT_DOUBLE_EQ(bb.MinZ, 0.0);
+    EXPECT_DOUBLE_EQ(bb.MaxX, 1.0);
+    EXPECT_DOUBLE_EQ(bb.MaxY, 5.0);
+    EXPECT_DOUBLE_EQ(bb.MaxZ, 3.0);
+}
+
+TEST_F(FeaturePartFuseTest, testTreeReductionNaming)
+{
+    // Arrange
+    _multiFuse->Shapes.setValues({_boxes[0], _boxes[1], _boxes[2]});
+    _multiFuse->execute();
+    auto standard = elementCenters(_multiFuse->Shape.getShape());
+    _multiFuse->Mode.setValue("TreeReduction");
+
+    // Act
+    _multiFuse->execute();
+    auto tree = elementCenters(_multiFuse->Shape.getShape());
+
+    // Assert: every face and edge has the same name as after a single fusion
+    ASSERT_FALSE(standard.empty());
+    EXPECT_EQ(tree.size(), standard.size());
+    for (const auto& [name, center] : standard) {
+        auto it = tree.find(name);
+        ASSERT_NE(it, tree.end()) << name;
+        EXPECT_TRUE(it->second.IsEqual(center, 1e-7)) << name;
+    }
+}
+
 TEST_F(FeaturePartFuseTest, testNonIntersecting)
 {
     // Arrange
@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include <src/App/InitApplication.h>
+#include <Mod/Part/App/TopoShapeOpCode.h>
 
 #include "PartTestHelpers.h"
 
@@ -54,3 +55,24 @@ TEST_F(FeaturePartMakeElementRefineTest, makeElementRefineBoxes)
     // TODO: Refine doesn't work on compounds, so we're going to need a binary operation or the
     // like, and those don't exist yet.  Once they do, this test can be expanded
 }
+
+TEST_F(FeaturePartMakeElementRefineTest, makeElementRefineManyFaces)
+{
+    // Arrange
+    const int count = 8;
+    std::vector<Part::TopoShape> boxes;
+    for (int i = 0; i < count; ++i) {
+        for (int j = 0; j < count; ++j) {
+            boxes.emplace_back(BRepPrimAPI_MakeBox(gp_Pnt(i, j, 0), 1.0, 1.0, 1.0).Shape());
+        }
+    }
+    Part::TopoShape fused;
+    fused.makeElementBoolean(Part::OpCodes::Fuse, boxes);
+    // Act
+    Part::TopoShape refined = fused.makeElementRefine();
+    // Assert
+    EXPECT_EQ(fused.countSubElements("Face"), 2 * count * count + 4 * count);
+    EXPECT_EQ(refined.countSubElements("Face"), 6);  // The grid of cubes is one box
+    EXPECT_EQ(refined.countSubElements("Edge"), 12);
+    EXPECT_DOUBLE_EQ(PartTestHelpers::getVolume(refined.getShape()), count * count);
+}
@@ -0,0 +1,175 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+// Headless benchmark of the model refine pass.
+//
+// Fuses synthetic bodies with thousands of coplanar and coaxial faces, like the ones left by
+// patterned PartDesign features, and times:
+//  - fusing the solids, once per scenario, which produces the faces to refine,
+//  - refining the fused shape with Part::BRepBuilderAPI_RefineModel,
+//  - refining it with TopoShape::makeElementRefine, i.e. including the element map, which is
+//    what features with Refine=true do.
+//
+// Usage: Part_benchmark [--scale N] [--repeat N] [--filter SCENARIO] [--output FILE]
+
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <Standard_Failure.hxx>
+#include <gp_Ax2.hxx>
+
+#include <Mod/Part/App/TopoShape.h>
+#include <Mod/Part/App/TopoShapeOpCode.h>
+#include <Mod/Part/App/modelRefine.h>
+#include <src/App/InitApplication.h>
+#include <src/Benchmark.h>
+
+namespace
+{
+
+using tests::benchmark::Harness;
+using tests::benchmark::Record;
+using tests::benchmark::timeMs;
+
+struct Options
+{
+    int scale {2};
+};
+
+struct Scenario
+{
+    std::string name;
+    // Returns the solids to fuse for the given scale
+    std::function<std::vector<Part::TopoShape>(int)> build;
+};
+
+Part::TopoShape makeBox(double x, double y, double z)
+{
+    return Part::TopoShape(BRepPrimAPI_MakeBox(gp_Pnt(x, y, z), 1.0, 1.0, 1.0).Shape());
+}
+
+// A plate made of a grid of unit cubes. Fused, every cube leaves a planar face on the top and
+// on the bottom of the plate, which the refine pass merges into one.
+std::vector<Part::TopoShape> buildPlate(int scale)
+{
+    const int side = 20 * scale;
+    std::vector<Part::TopoShape> solids;
+    for (int i = 0; i < side; ++i) {
+        for (int j = 0; j < side; ++j) {
+            solids.push_back(makeBox(i, j, 0));
+        }
+    }
+    return solids;
+}
+
+// A smaller plate with a pin on every cube, each pin a stack of coaxial cylinders. Fused, every
+// pin has a cylindrical face per cylinder, which the refine pass merges into one.
+std::vector<Part::TopoShape> buildPins(int scale)
+{
+    const int side = 10 * scale;
+    const int stack = 4;
+    std::vector<Part::TopoShape> solids;
+    for (int i = 0; i < side; ++i) {
+        for (int j = 0; j < side; ++j) {
+            solids.push_back(makeBox(i, j, 0));
+            for (int k = 0; k < stack; ++k) {
+                gp_Ax2 axis(gp_Pnt(i + 0.5, j + 0.5, 1.0 + k), gp::DZ());
+                solids.emplace_back(BRepPrimAPI_MakeCylinder(axis, 0.3, 1.0).Shape());
+            }
+        }
+    }
+    return solids;
+}
+
+class Benchmark
+{
+public:
+    Benchmark(const Options& options, Harness& harness)
+        : options(options)
+        , harness(harness)
+    {}
+
+    bool run(const Scenario& scenario)
+    {
+        std::vector<Part::TopoShape> solids = scenario.build(options.scale);
+        Part::TopoShape fused;
+        std::vector<double> fuse {timeMs([&]() {
+            fused.makeElementBoolean(Part::OpCodes::Fuse, solids);
+        })};
+        faces = fused.countSubShapes(TopAbs_FACE);
+
+        std::vector<double> refine;
+        std::vector<double> refineNamed;
+        for (int i = 0; i < harness.repeat(); ++i) {
+            try {
+                refine.push_back(timeMs([&]() {
+                    Part::BRepBuilderAPI_RefineModel mkRefine(fused.getShape());
+                    refinedFaces = Part::TopoShape(mkRefine.Shape()).countSubShapes(TopAbs_FACE);
+                }));
+                refineNamed.push_back(timeMs([&]() { fused.makeElementRefine(); }));
+            }
+            catch (const Standard_Failure& e) {
+                std::cerr << "Cannot refine " << scenario.name << ": " << e.GetMessageString()
+                          << "\n";
+                return false;
+            }
+        }
+
+        report(scenario, "fuse", fuse);
+        report(scenario, "refine", refine);
+        report(scenario, "makeElementRefine", refineNamed);
+        return true;
+    }
+
+private:
+    void report(const Scenario& scenario, const char* phase, const std::vector<double>& samples)
+    {
+        Record()
+            .add("scenario", scenario.name)
+            .add("scale", options.scale)
+            .add("faces", faces)
+            .add("refined_faces", refinedFaces)
+            .add("phase", phase)
+            .addSamples(samples)
+            .write(harness.out());
+    }
+
+    const Options& options;
+    Harness& harness;
+    unsigned long faces {0};
+    unsigned long refinedFaces {0};
+};
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    Options options;
+    Harness harness(3);
+    harness.addOption("--scale", options.scale);
+    if (!harness.init(argc, argv)) {
+        return 1;
+    }
+
+    tests::initApplication();
+
+    const std::vector<Scenario> scenarios {
+        {"plate", buildPlate},
+        {"pins", buildPins},
+    };
+
+    Benchmark benchmark(options, harness);
+    for (const auto& scenario : scenarios) {
+        if (!harness.selected(scenario.name)) {
+            continue;
+        }
+        if (!benchmark.run(scenario)) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -178,3 +178,79 @@ TEST_F(ConstraintsTest, tangentBSplineAndArc)  // NOLINT
         0.005
     );
 }
+
+TEST_F(ConstraintsTest, commonConstraintsWithSharedParameters)  // NOLINT
+{
+    // Arrange
+    // Two lines joined by a coincidence at a right angle, a point on the first line and two
+    // tangent circles centered at the free ends. The coincidence and the equality are reduced
+    // to shared solver parameters, so constraints see the same parameter more than once.
+    double l1p1X = 0.0, l1p1Y = 0.0, l1p2X = 2.8, l1p2Y = 0.2;
+    double l2p1X = 2.9, l2p1Y = -0.1, l2p2X = 3.2, l2p2Y = 3.7;
+    double pointX = 1.0, pointY = 0.3;
+    double radius1 = 1.2, radius2 = 3.5, radius3 = 3.0;
+    double origin = 0.0, one = 1.0, length1 = 3.0, length2 = 4.0;
+    double angle = std::numbers::pi / 2;
+    GCS::Point l1p1, l1p2, l2p1, l2p2, point;
+    l1p1.x = &l1p1X;
+    l1p1.y = &l1p1Y;
+    l1p2.x = &l1p2X;
+    l1p2.y = &l1p2Y;
+    l2p1.x = &l2p1X;
+    l2p1.y = &l2p1Y;
+    l2p2.x = &l2p2X;
+    l2p2.y = &l2p2Y;
+    point.x = &pointX;
+    point.y = &pointY;
+    GCS::Line line1, line2;
+    line1.p1 = l1p1;
+    line1.p2 = l1p2;
+    line2.p1 = l2p1;
+    line2.p2 = l2p2;
+    std::vector<double*> params = {
+        l1p1.x,
+        l1p1.y,
+        l1p2.x,
+        l1p2.y,
+        l2p1.x,
+        l2p1.y,
+        l2p2.x,
+        l2p2.y,
+        point.x,
+        point.y,
+        &radius1,
+        &radius2,
+        &radius3,
+    };
+
+    // Act
+    int tag = 1;
+    System()->addConstraintCoordinateX(l1p1, &origin, tag++);
+    System()->addConstraintCoordinateY(l1p1, &origin, tag++);
+    System()->addConstraintHorizontal(line1, tag++);
+    System()->addConstraintP2PDistance(l1p1, l1p2, &length1, tag++);
+    System()->addConstraintP2PCoincident(l1p2, l2p1, tag++);
+    System()->addConstraintL2LAngle(line1, line2, &angle, tag++);
+    System()->addConstraintP2PDistance(l2p1, l2p2, &length2, tag++);
+    System()->addConstraintPointOnLine(point, line1, tag++);
+    System()->addConstraintCoordinateX(point, &one, tag++);
+    System()->addConstraintEqual(&radius1, &one, tag++);
+    System()->addConstraintTangentCircumf(l1p1, l2p2, &radius1, &radius2, false, tag++);
+    System()->addConstraintEqual(&radius3, &radius2, tag++);
+    System()->declareUnknowns(params);
+    System()->initSolution();
+    int solveResult = System()->solve(true, GCS::DogLeg);
+    if (solveResult == GCS::Success) {
+        System()->applySolution();
+    }
+    System()->diagnose();
+
+    // Assert
+    EXPECT_EQ(solveResult, GCS::Success);
+    EXPECT_EQ(System()->dofsNumber(), 0);
+    EXPECT_NEAR(l2p2X, 3.0, 1e-9);
+    EXPECT_NEAR(l2p2Y, 4.0, 1e-9);
+    EXPECT_NEAR(pointY, 0.0, 1e-9);
+    EXPECT_NEAR(radius2, 4.0, 1e-9);
+    EXPECT_NEAR(radius3, 4.0, 1e-9);
+}
@@ -1,5 +1,7 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "Mod/Sketcher/App/planegcs/GCS.h"
@@ -50,3 +52,246 @@ TEST_F(GCSTest, clearConstraints)  // NOLINT
     // Assert
     EXPECT_EQ(0, System()->getNumberOfConstraints());
 }
+
+TEST_F(GCSTest, solveLargeChain)  // NOLINT
+{
+    // Arrange
+    // A chain of points, each one horizontal to and at unit distance from the previous one.
+    // Every constraint only depends on four of the parameters, i.e. the Jacobian is sparse.
+    const int numPoints {200};
+    for (auto alg : {GCS::DogLeg, GCS::LevenbergMarquardt}) {
+        std::vector<double> coords(2 * numPoints);
+        std::vector<GCS::Point> points(numPoints);
+        GCS::VEC_pD params;
+        for (int i = 0; i < numPoints; ++i) {
+            coords[2 * i] = 1.1 * i;
+            coords[2 * i + 1] = 0.05 * (i % 3);
+            points[i].x = &coords[2 * i];
+            points[i].y = &coords[2 * i + 1];
+            params.push_back(points[i].x);
+            params.push_back(points[i].y);
+        }
+        double origin {0.0};
+        double distance {1.0};
+        int tag {1};
+        System()->addConstraintCoordinateX(points[0], &origin, tag++);
+        System()->addConstraintCoordinateY(points[0], &origin, tag++);
+        for (int i = 1; i < numPoints; ++i) {
+            System()->addConstraintHorizontal(points[i - 1], points[i], tag++);
+            System()->addConstraintP2PDistance(points[i - 1], points[i], &distance, tag++);
+        }
+
+        // Act
+        System()->declareUnknowns(params);
+        System()->initSolution(alg);
+        int status = System()->solve(true, alg);
+        System()->applySolution();
+        System()->diagnose(alg);
+
+        // Assert
+        EXPECT_EQ(status, GCS::Success);
+        EXPECT_EQ(System()->dofsNumber(), 0);
+        EXPECT_NEAR(coords[2 * (numPoints - 1)], numPoints - 1, 1e-6);
+        EXPECT_NEAR(coords[2 * (numPoints - 1) + 1], 0.0, 1e-6);
+
+        System()->clear();
+    }
+}
+
+TEST_F(GCSTest, solveIndependentClustersConcurrently)  // NOLINT
+{
+    // Arrange
+    // Many unconnected segments, each one is a separate subsystem
+    const int numSegments {100};
+    auto solveSegments = [&](int maxThreads, std::vector<double>& coords) {
+        coords.resize(4 * numSegments);
+        std::vector<GCS::Point> points(2 * numSegments);
+        GCS::VEC_pD params;
+        for (int i = 0; i < 2 * numSegments; ++i) {
+            coords[2 * i] = 0.1 * i + 0.3 * (i % 2);
+            coords[2 * i + 1] = 0.01 * (i % 7);
+            points[i].x = &coords[2 * i];
+            points[i].y = &coords[2 * i + 1];
+            params.push_back(points[i].x);
+            params.push_back(points[i].y);
+        }
+        std::vector<double> lengths(numSegments);
+        int tag {1};
+        for (int i = 0; i < numSegments; ++i) {
+            lengths[i] = 1.0 + 0.01 * i;
+            System()->addConstraintHorizontal(points[2 * i], points[2 * i + 1], tag++);
+            System()->addConstraintP2PDistance(points[2 * i], points[2 * i + 1], &lengths[i], tag++);
+        }
+        System()->maxThreads = maxThreads;
+        System()->declareUnknowns(params);
+        System()->initSolution();
+        int status = System()->solve(true, GCS::DogLeg);
+        System()->applySolution();
+        System()->clear();
+        return status;
+    };
+
+    // Act
+    std::vector<double> serial, concurrent;
+    int serialStatus = solveSegments(1, serial);
+    int concurrentStatus = solveSegments(4, concurrent);
+
+    // Assert
+    EXPECT_EQ(serialStatus, GCS::Success);
+    EXPECT_EQ(concurrentStatus, serialStatus);
+    EXPECT_EQ(concurrent, serial);
+}
+
+TEST_F(GCSTest, solveTemporaryDragsOnlyMovedCluster)  // NOLINT
+{
+    // Arrange
+    // Unconnected horizontal segments, the end of the first one is dragged
+    const int numSegments {20};
+    std::vector<double> coords(4 * numSegments);
+    std::vector<GCS::Point> points(2 * numSegments);
+    GCS::VEC_pD params;
+    for (int i = 0; i < 2 * numSegments; ++i) {
+        coords[2 * i] = 0.1 * i + 0.3 * (i % 2);
+        coords[2 * i + 1] = 0.01 * (i % 7);
+        points[i].x = &coords[2 * i];
+        points[i].y = &coords[2 * i + 1];
+        params.push_back(points[i].x);
+        params.push_back(points[i].y);
+    }
+    std::vector<double> lengths(numSegments, 1.0);
+    int tag {1};
+    for (int i = 0; i < numSegments; ++i) {
+        System()->addConstraintHorizontal(points[2 * i], points[2 * i + 1], tag++);
+        System()->addConstraintP2PDistance(points[2 * i], points[2 * i + 1], &lengths[i], tag++);
+    }
+    double moveX {coords[2]};
+    double moveY {coords[3]};
+    GCS::Point mouse;
+    mouse.x = &moveX;
+    mouse.y = &moveY;
+    System()->addConstraintP2PCoincident(mouse, points[1], GCS::DefaultTemporaryConstraint);
+    System()->declareUnknowns(params);
+    System()->initSolution();
+    ASSERT_EQ(System()->solve(true, GCS::DogLeg), GCS::Success);
+    System()->applySolution();
+    std::vector<double> others(coords.begin() + 4, coords.end());
+
+    // Act
+    int status {GCS::Success};
+    for (int step = 1; step <= 20 && status == GCS::Success; ++step) {
+        moveX = 1.0 + 0.05 * step;
+        moveY = 0.02 * step;
+        status = System()->solveTemporary(true, GCS::DogLeg);
+        System()->applySolution();
+    }
+    std::vector<double> warm(coords);
+    int coldStatus = System()->solve(true, GCS::DogLeg);
+    System()->applySolution();
+
+    // Assert
+    EXPECT_EQ(status, GCS::Success);
+    EXPECT_EQ(coldStatus, GCS::Success);
+    EXPECT_NEAR(warm[2], 2.0, 1e-8);
+    EXPECT_NEAR(warm[3], 0.4, 1e-8);
+    EXPECT_NEAR(warm[0], 1.0, 1e-8);
+    EXPECT_NEAR(warm[1], 0.4, 1e-8);
+    EXPECT_EQ(std::vector<double>(warm.begin() + 4, warm.end()), others);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_NEAR(warm[i], coords[i], 1e-8);
+    }
+}
+
+TEST_F(GCSTest, diagnoseReusesStructuralDiagnosis)  // NOLINT
+{
+    // Arrange
+    // A segment from a fixed point, plus a point only fixed in y
+    std::vector<double> coords {0.0, 0.0, 0.8, 0.1, 0.5, 0.5};
+    std::vector<GCS::Point> points(3);
+    GCS::VEC_pD params;
+    for (int i = 0; i < 3; ++i) {
+        points[i].x = &coords[2 * i];
+        points[i].y = &coords[2 * i + 1];
+        params.push_back(points[i].x);
+        params.push_back(points[i].y);
+    }
+    double origin {0.0};
+    double length {1.0};
+    auto setUp = [&](bool redundantDistance) {
+        System()->clear();
+        System()->addConstraintCoordinateX(points[0], &origin, 1);
+        System()->addConstraintCoordinateY(points[0], &origin, 2);
+        System()->addConstraintHorizontal(points[0], points[1], 3);
+        System()->addConstraintP2PDistance(points[0], points[1], &length, 4);
+        System()->addConstraintCoordinateY(points[2], &origin, 5);
+        if (redundantDistance) {
+            System()->addConstraintP2PDistance(points[0], points[1], &length, 6);
+        }
+        System()->declareUnknowns(params);
+        System()->initSolution();
+    };
+    setUp(false);
+    ASSERT_FALSE(System()->isDiagnosisCached());
+    GCS::VEC_pD dependent;
+    System()->getDependentParams(dependent);
+
+    // Act
+    length = 2.0;
+    setUp(false);
+    bool cached = System()->isDiagnosisCached();
+    int dofs = System()->dofsNumber();
+    GCS::VEC_pD cachedDependent;
+    System()->getDependentParams(cachedDependent);
+    int status = System()->solve(true, GCS::DogLeg);
+    System()->applySolution();
+    setUp(true);
+    bool cachedWithRedundant = System()->isDiagnosisCached();
+    bool hasRedundant = System()->hasRedundant();
+    setUp(false);
+    bool cachedAfterRedundant = System()->isDiagnosisCached();
+
+    // Assert
+    EXPECT_TRUE(cached);
+    EXPECT_EQ(dofs, 1);
+    EXPECT_EQ(cachedDependent, dependent);
+    EXPECT_EQ(status, GCS::Success);
+    EXPECT_NEAR(coords[2], 2.0, 1e-8);
+    EXPECT_FALSE(cachedWithRedundant);
+    EXPECT_TRUE(hasRedundant);
+    EXPECT_FALSE(cachedAfterRedundant);
+}
+
+TEST_F(GCSTest, diagnoseRedoesDiagnosisWhenRankChanges)  // NOLINT
+{
+    // Arrange
+    // A segment from a fixed point, horizontal and with a fixed length
+    std::vector<double> coords {0.0, 0.0, 0.8, 0.1};
+    GCS::Point p1 {&coords[0], &coords[1]};
+    GCS::Point p2 {&coords[2], &coords[3]};
+    GCS::VEC_pD params {p1.x, p1.y, p2.x, p2.y};
+    double origin {0.0};
+    double length {1.0};
+    auto setUp = [&]() {
+        System()->clear();
+        System()->addConstraintCoordinateX(p1, &origin, 1);
+        System()->addConstraintCoordinateY(p1, &origin, 2);
+        System()->addConstraintHorizontal(p1, p2, 3);
+        System()->addConstraintP2PDistance(p1, p2, &length, 4);
+        System()->declareUnknowns(params);
+        System()->initSolution();
+    };
+    setUp();
+
+    // Act
+    // With a vertical segment the gradients of the distance and horizontal constraints are
+    // parallel, i.e. the same structure has a lower rank
+    coords[2] = 0.0;
+    coords[3] = 1.0;
+    setUp();
+    bool cached = System()->isDiagnosisCached();
+    bool hasConflicting = System()->hasConflicting();
+    bool hasRedundant = System()->hasRedundant();
+
+    // Assert
+    EXPECT_FALSE(cached);
+    EXPECT_TRUE(hasConflicting || hasRedundant);
+}
@@ -0,0 +1,385 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+// Headless benchmark of the Sketcher solver.
+//
+// Builds synthetic sketches and times, on a standalone Sketcher::Sketch, the same calls
+// SketchObject does on recompute and while dragging:
+//  - setUpSketch, i.e. building the solver system and diagnosing it, with dense and sparse QR,
+//    once from scratch and once reusing the diagnosis of the previous set up,
+//  - solve with each of the solvers,
+//  - the drag path (initMove and moveGeometry) with DogLeg.
+//
+// Usage: Sketcher_benchmark [--scale N] [--repeat N] [--filter SCENARIO] [--output FILE]
+
+#include <array>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <numbers>
+#include <string>
+#include <vector>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <Mod/Part/App/Geometry.h>
+#include <Mod/Sketcher/App/Constraint.h>
+#include <Mod/Sketcher/App/GeoEnum.h>
+#include <Mod/Sketcher/App/Sketch.h>
+#include <Mod/Sketcher/App/SketchObject.h>
+#include <src/App/InitApplication.h>
+#include <src/Benchmark.h>
+
+namespace
+{
+
+using Sketcher::ConstraintType;
+using Sketcher::GeoEnum;
+using Sketcher::PointPos;
+using tests::benchmark::Harness;
+using tests::benchmark::Record;
+using tests::benchmark::timeMs;
+
+struct Options
+{
+    int scale {1};
+    int dragSteps {20};
+};
+
+struct Scenario
+{
+    std::string name;
+    // Fills the sketch with a drawing of the given scale and returns the point to drag
+    std::function<Sketcher::GeoElementId(Sketcher::SketchObject*, int)> build;
+};
+
+struct Timings
+{
+    std::vector<double> samples;  // milliseconds
+    int status {0};
+};
+
+Sketcher::Constraint* makeConstraint(
+    ConstraintType type,
+    int first,
+    PointPos firstPos,
+    int second = GeoEnum::GeoUndef,
+    PointPos secondPos = PointPos::none,
+    double value = 0.0
+)
+{
+    auto constr = new Sketcher::Constraint();
+    constr->Type = type;
+    constr->First = first;
+    constr->FirstPos = firstPos;
+    constr->Second = second;
+    constr->SecondPos = secondPos;
+    constr->setValue(value);
+    return constr;
+}
+
+Sketcher::Constraint* coincident(int first, PointPos firstPos, int second, PointPos secondPos)
+{
+    return makeConstraint(ConstraintType::Coincident, first, firstPos, second, secondPos);
+}
+
+// a dimension of a single element, e.g. the length of a line or the position of a point
+Sketcher::Constraint* dimension(ConstraintType type, int geoId, PointPos pos, double value)
+{
+    return makeConstraint(type, geoId, pos, GeoEnum::GeoUndef, PointPos::none, value);
+}
+
+int addLine(Sketcher::SketchObject* sketch, const Base::Vector3d& start, const Base::Vector3d& end)
+{
+    Part::GeomLineSegment line;
+    line.setPoints(start, end);
+    return sketch->addGeometry(&line);
+}
+
+void addConstraints(Sketcher::SketchObject* sketch, std::vector<Sketcher::Constraint*>& constraints)
+{
+    sketch->addConstraints(constraints);
+    for (auto constr : constraints) {
+        delete constr;
+    }
+    constraints.clear();
+}
+
+// Fully constrained rectangles, each one dimensioned and placed relative to the origin.
+// The geometry is slightly off, so that the solver has some work to do.
+Sketcher::GeoElementId buildRectangleGrid(Sketcher::SketchObject* sketch, int scale)
+{
+    const int side = 5 * scale;
+    std::vector<Sketcher::Constraint*> constraints;
+    int lastLine = 0;
+    for (int i = 0; i < side; ++i) {
+        for (int j = 0; j < side; ++j) {
+            double x = 3.0 * i;
+            double y = 3.0 * j;
+            double w = 2.1;
+            double h = 0.9;
+            int l0 = addLine(sketch, {x, y, 0}, {x + w, y, 0});
+            int l1 = addLine(sketch, {x + w, y, 0}, {x + w, y + h, 0});
+            int l2 = addLine(sketch, {x + w, y + h, 0}, {x, y + h, 0});
+            int l3 = addLine(sketch, {x, y + h, 0}, {x, y, 0});
+            constraints.push_back(coincident(l0, PointPos::end, l1, PointPos::start));
+            constraints.push_back(coincident(l1, PointPos::end, l2, PointPos::start));
+            constraints.push_back(coincident(l2, PointPos::end, l3, PointPos::start));
+            constraints.push_back(coincident(l3, PointPos::end, l0, PointPos::start));
+            constraints.push_back(makeConstraint(ConstraintType::Horizontal, l0, PointPos::none));
+            constraints.push_back(makeConstraint(ConstraintType::Horizontal, l2, PointPos::none));
+            constraints.push_back(makeConstraint(ConstraintType::Vertical, l1, PointPos::none));
+            constraints.push_back(makeConstraint(ConstraintType::Vertical, l3, PointPos::none));
+            constraints.push_back(dimension(ConstraintType::DistanceX, l0, PointPos::none, 2.0));
+            constraints.push_back(dimension(ConstraintType::DistanceY, l1, PointPos::none, 1.0));
+            constraints.push_back(dimension(ConstraintType::DistanceX, l0, PointPos::start, x));
+            constraints.push_back(dimension(ConstraintType::DistanceY, l0, PointPos::start, y));
+            lastLine = l1;
+        }
+    }
+    addConstraints(sketch, constraints);
+    return Sketcher::GeoElementId(lastLine, PointPos::end);
+}
+
+// Cubic B-splines joined end to start, with their control polygon exposed as the Sketcher
+// does when creating them.
+Sketcher::GeoElementId buildBSplineChain(Sketcher::SketchObject* sketch, int scale)
+{
+    const int count = 10 * scale;
+    const int degree = 3;
+    std::vector<double> weights(5, 1.0);
+    std::vector<double> knots {0.0, 1.0, 2.0};
+    std::vector<int> multiplicities {degree + 1, 1, degree + 1};
+    std::vector<int> splines;
+    for (int i = 0; i < count; ++i) {
+        double x = 4.0 * i;
+        std::vector<Base::Vector3d> poles {
+            {x, 0, 0},
+            {x + 1, 1, 0},
+            {x + 2, -1, 0},
+            {x + 3, 1, 0},
+            {x + 4.1, 0.1, 0},
+        };
+        Part::GeomBSplineCurve spline(poles, weights, knots, multiplicities, degree, false);
+        splines.push_back(sketch->addGeometry(&spline));
+    }
+    for (int spline : splines) {
+        sketch->exposeInternalGeometry(spline);
+    }
+    std::vector<Sketcher::Constraint*> constraints;
+    for (int i = 1; i < count; ++i) {
+        constraints.push_back(
+            coincident(splines[i - 1], PointPos::end, splines[i], PointPos::start)
+        );
+    }
+    constraints.push_back(dimension(ConstraintType::DistanceX, splines[0], PointPos::start, 0.0));
+    constraints.push_back(dimension(ConstraintType::DistanceY, splines[0], PointPos::start, 0.0));
+    addConstraints(sketch, constraints);
+    return Sketcher::GeoElementId(splines.back(), PointPos::end);
+}
+
+// A row of circles sharing their radius through equality constraints, as produced by arrays.
+Sketcher::GeoElementId buildEqualArray(Sketcher::SketchObject* sketch, int scale)
+{
+    const int count = 50 * scale;
+    std::vector<Sketcher::Constraint*> constraints;
+    std::vector<int> circles;
+    for (int i = 0; i < count; ++i) {
+        Part::GeomCircle circle;
+        circle.setCenter(Base::Vector3d(3.0 * i + 0.1, 0.05 * (i % 3), 0));
+        circle.setRadius(1.0 + 0.01 * (i % 5));
+        circles.push_back(sketch->addGeometry(&circle));
+    }
+    constraints.push_back(dimension(ConstraintType::Radius, circles[0], PointPos::none, 1.0));
+    constraints.push_back(dimension(ConstraintType::DistanceX, circles[0], PointPos::mid, 0.0));
+    constraints.push_back(dimension(ConstraintType::DistanceY, circles[0], PointPos::mid, 0.0));
+    for (int i = 1; i < count; ++i) {
+        int first = circles[0];
+        int prev = circles[i - 1];
+        int cur = circles[i];
+        const auto mid = PointPos::mid;
+        constraints.push_back(makeConstraint(ConstraintType::Equal, first, PointPos::none, cur));
+        constraints.push_back(makeConstraint(ConstraintType::Horizontal, prev, mid, cur, mid));
+        constraints.push_back(makeConstraint(ConstraintType::DistanceX, prev, mid, cur, mid, 3.0));
+    }
+    addConstraints(sketch, constraints);
+    return Sketcher::GeoElementId(circles.back(), PointPos::mid);
+}
+
+// Many unrelated closed polylines only held together by coincidences, as left by a DXF import.
+// The sketch has plenty of degrees of freedom and independent subsystems.
+Sketcher::GeoElementId buildImportedClusters(Sketcher::SketchObject* sketch, int scale)
+{
+    const int count = 50 * scale;
+    const int sides = 6;
+    std::vector<Sketcher::Constraint*> constraints;
+    int lastLine = 0;
+    for (int i = 0; i < count; ++i) {
+        Base::Vector3d center(5.0 * (i % 10), 5.0 * (i / 10), 0);
+        std::array<int, sides> lines {};
+        for (int k = 0; k < sides; ++k) {
+            double a0 = 2.0 * std::numbers::pi * k / sides;
+            double a1 = 2.0 * std::numbers::pi * (k + 1) / sides;
+            lines[k] = addLine(
+                sketch,
+                center + Base::Vector3d(2.0 * std::cos(a0), 2.0 * std::sin(a0), 0),
+                center + Base::Vector3d(2.0 * std::cos(a1), 2.0 * std::sin(a1), 0)
+            );
+        }
+        for (int k = 0; k < sides; ++k) {
+            int next = lines[(k + 1) % sides];
+            constraints.push_back(coincident(lines[k], PointPos::end, next, PointPos::start));
+        }
+        lastLine = lines[0];
+    }
+    addConstraints(sketch, constraints);
+    return Sketcher::GeoElementId(lastLine, PointPos::start);
+}
+
+class Benchmark
+{
+public:
+    Benchmark(const Options& options, Harness& harness)
+        : options(options)
+        , harness(harness)
+    {}
+
+    void run(const Scenario& scenario, Sketcher::SketchObject* sketch)
+    {
+        Sketcher::GeoElementId dragged = scenario.build(sketch, options.scale);
+        geometries = sketch->getCompleteGeometry();
+        constraints = sketch->Constraints.getValues();
+        externalCount = sketch->getExternalGeometryCount();
+
+        const std::array<std::pair<GCS::QRAlgorithm, const char*>, 2> qrAlgorithms {
+            {{GCS::EigenDenseQR, "DenseQR"}, {GCS::EigenSparseQR, "SparseQR"}}
+        };
+        for (const auto& [qrAlgorithm, qrName] : qrAlgorithms) {
+            Sketcher::Sketch solver;
+            configure(solver);
+            solver.setSketchAutoAlgo(false);
+            solver.setQRAlgorithm(qrAlgorithm);
+
+            Timings cold;
+            Timings cached;
+            for (int i = 0; i < harness.repeat(); ++i) {
+                solver.clearDiagnosisCache();
+                cold.samples.push_back(timeMs([&]() { dofs = setUp(solver); }));
+                cached.samples.push_back(timeMs([&]() { setUp(solver); }));
+            }
+            report(scenario, "setUpSketch", qrName, cold);
+            report(scenario, "setUpSketchCached", qrName, cached);
+        }
+
+        const std::array<std::pair<GCS::Algorithm, const char*>, 3> algorithms {
+            {{GCS::BFGS, "BFGS"},
+             {GCS::LevenbergMarquardt, "LevenbergMarquardt"},
+             {GCS::DogLeg, "DogLeg"}}
+        };
+        for (const auto& [algorithm, algorithmName] : algorithms) {
+            Sketcher::Sketch solver;
+            configure(solver);
+            solver.defaultSolver = algorithm;
+
+            Timings solve;
+            for (int i = 0; i < harness.repeat(); ++i) {
+                setUp(solver);
+                solve.samples.push_back(timeMs([&]() { solve.status = solver.solve(); }));
+            }
+            report(scenario, "solve", algorithmName, solve);
+        }
+
+        Sketcher::Sketch solver;
+        configure(solver);
+        Timings drag;
+        for (int i = 0; i < harness.repeat(); ++i) {
+            setUp(solver);
+            solver.solve();
+            Base::Vector3d start = solver.getPoint(dragged.GeoId, dragged.Pos);
+            for (int step = 1; step <= options.dragSteps && drag.status == 0; ++step) {
+                Base::Vector3d toPoint = start + Base::Vector3d(0.02 * step, 0.01 * step, 0);
+                drag.samples.push_back(timeMs([&]() {
+                    drag.status = solver.moveGeometry(dragged.GeoId, dragged.Pos, toPoint);
+                }));
+            }
+        }
+        report(scenario, "drag", "DogLeg", drag);
+    }
+
+private:
+    void configure(Sketcher::Sketch& solver) const
+    {
+        solver.setDebugMode(GCS::NoDebug);
+    }
+
+    int setUp(Sketcher::Sketch& solver) const
+    {
+        return solver.setUpSketch(geometries, constraints, externalCount);
+    }
+
+    void report(
+        const Scenario& scenario,
+        const char* phase,
+        const char* variant,
+        const Timings& timings
+    )
+    {
+        Record()
+            .add("scenario", scenario.name)
+            .add("scale", options.scale)
+            .add("geometries", static_cast<int>(geometries.size()) - externalCount)
+            .add("constraints", constraints.size())
+            .add("dofs", dofs)
+            .add("phase", phase)
+            .add("variant", variant)
+            .add("status", timings.status)
+            .addSamples(timings.samples)
+            .write(harness.out());
+    }
+
+    const Options& options;
+    Harness& harness;
+    std::vector<Part::Geometry*> geometries;
+    std::vector<Sketcher::Constraint*> constraints;
+    int externalCount {0};
+    int dofs {0};
+};
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    Options options;
+    Harness harness(5);
+    harness.addOption("--scale", options.scale);
+    if (!harness.init(argc, argv)) {
+        return 1;
+    }
+
+    tests::initApplication();
+
+    const std::vector<Scenario> scenarios {
+        {"rectangle_grid", buildRectangleGrid},
+        {"bspline_chain", buildBSplineChain},
+        {"equal_array", buildEqualArray},
+        {"imported_clusters", buildImportedClusters},
+    };
+
+    Benchmark benchmark(options, harness);
+    for (const auto& scenario : scenarios) {
+        if (!harness.selected(scenario.name)) {
+            continue;
+        }
+        std::string docName = App::GetApplication().getUniqueDocumentName("benchmark");
+        auto doc = App::GetApplication().newDocument(docName.c_str(), "benchmark");
+        auto sketch =
+            dynamic_cast<Sketcher::SketchObject*>(doc->addObject("Sketcher::SketchObject"));
+        if (!sketch) {
+            std::cerr << "Cannot create a sketch, is the Sketcher module available?\n";
+            return 1;
+        }
+        benchmark.run(scenario, sketch);
+        App::GetApplication().closeDocument(docName.c_str());
+    }
+
+    return 0;
+}
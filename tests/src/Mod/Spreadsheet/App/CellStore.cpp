@@ -0,0 +1,183 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <Mod/Spreadsheet/App/CellStore.h>
+
+using App::CellAddress;
+using Spreadsheet::Cell;
+using Spreadsheet::CellDependencyMap;
+using Spreadsheet::CellStore;
+
+namespace
+{
+
+// The store never dereferences the cells, so fake ones are enough
+Cell* fakeCell(int value)
+{
+    return reinterpret_cast<Cell*>(static_cast<std::uintptr_t>(value + 1));  // NOLINT
+}
+
+std::vector<std::pair<CellAddress, Cell*>> contents(const CellStore& store)
+{
+    return {store.begin(), store.end()};
+}
+
+std::vector<std::pair<CellAddress, Cell*>> contents(const std::map<CellAddress, Cell*>& map)
+{
+    return {map.begin(), map.end()};
+}
+
+}  // namespace
+
+TEST(CellStore, emptyStore)  // NOLINT
+{
+    CellStore store;
+    EXPECT_TRUE(store.empty());
+    EXPECT_EQ(store.size(), 0);
+    EXPECT_TRUE(store.begin() == store.end());
+    EXPECT_TRUE(store.find(CellAddress(3, 4)) == store.end());
+    EXPECT_EQ(store.count(CellAddress(3, 4)), 0);
+    EXPECT_EQ(store.erase(CellAddress(3, 4)), 0);
+}
+
+TEST(CellStore, iteratesInAddressOrder)  // NOLINT
+{
+    CellStore store;
+    std::map<CellAddress, Cell*> reference;
+    // spread over several blocks, inserted out of order
+    for (int row : {500, 3, 64, 0, 31, 32, 1000, 33}) {
+        for (int col : {7, 0, 2}) {
+            store[CellAddress(row, col)] = fakeCell(row * 10 + col);
+            reference[CellAddress(row, col)] = fakeCell(row * 10 + col);
+        }
+    }
+    EXPECT_EQ(store.size(), reference.size());
+    EXPECT_EQ(contents(store), contents(reference));
+}
+
+TEST(CellStore, subscriptReturnsExistingSlot)  // NOLINT
+{
+    CellStore store;
+    store[CellAddress(2, 2)] = fakeCell(1);
+    EXPECT_EQ(store[CellAddress(2, 2)], fakeCell(1));
+    EXPECT_EQ(store.size(), 1);
+
+    // a new slot is empty until assigned
+    EXPECT_EQ(store[CellAddress(2, 1)], nullptr);
+    EXPECT_EQ(store.size(), 2);
+}
+
+TEST(CellStore, findAndErase)  // NOLINT
+{
+    CellStore store;
+    for (int row = 0; row < 100; ++row) {
+        store[CellAddress(row, 1)] = fakeCell(row);
+    }
+
+    const CellStore& constStore = store;
+    auto it = constStore.find(CellAddress(40, 1));
+    ASSERT_TRUE(it != constStore.end());
+    EXPECT_EQ(it->second, fakeCell(40));
+
+    // erasing returns the following cell, also across blocks
+    auto next = store.erase(store.find(CellAddress(63, 1)));
+    ASSERT_TRUE(next != store.end());
+    EXPECT_EQ(next->first, CellAddress(64, 1));
+    EXPECT_EQ(store.count(CellAddress(63, 1)), 0);
+
+    EXPECT_EQ(store.erase(CellAddress(99, 1)), 1);
+    EXPECT_EQ(store.erase(CellAddress(99, 1)), 0);
+    EXPECT_EQ(store.size(), 98);
+
+    store.clear();
+    EXPECT_TRUE(store.empty());
+    EXPECT_TRUE(store.begin() == store.end());
+}
+
+TEST(CellStore, matchesMapUnderRandomEdits)  // NOLINT
+{
+    CellStore store;
+    std::map<CellAddress, Cell*> reference;
+    std::mt19937 random(42);  // NOLINT
+    std::uniform_int_distribution<int> rows(0, 300);
+    std::uniform_int_distribution<int> cols(0, 20);
+
+    for (int i = 0; i < 20000; ++i) {
+        CellAddress address(rows(random), cols(random));
+        if (i % 3 == 2) {
+            EXPECT_EQ(store.erase(address), reference.erase(address));
+        }
+        else {
+            store[address] = fakeCell(i);
+            reference[address] = fakeCell(i);
+        }
+    }
+    EXPECT_EQ(store.size(), reference.size());
+    EXPECT_EQ(contents(store), contents(reference));
+
+    // copies are independent
+    CellStore copy(store);
+    copy.clear();
+    EXPECT_EQ(contents(store), contents(reference));
+}
+
+TEST(CellDependencyMap, insertAndLookup)  // NOLINT
+{
+    CellDependencyMap deps;
+    deps.insert(CellAddress(0, 0), "Doc#Sheet.A2");
+    deps.insert(CellAddress(0, 0), "Doc#Box.Length");
+    deps.insert(CellAddress(1, 0), "Doc#Sheet.A2");
+    deps.insert(CellAddress(1, 0), "Doc#Sheet.A2");  // duplicates are ignored
+
+    auto cells = deps.getCells("Doc#Sheet.A2");
+    std::set<CellAddress> cellSet(cells.begin(), cells.end());
+    EXPECT_EQ(cells.size(), 2);
+    EXPECT_EQ(cellSet, (std::set<CellAddress> {CellAddress(0, 0), CellAddress(1, 0)}));
+    EXPECT_EQ(
+        deps.getNames(CellAddress(0, 0)),
+        (std::set<std::string> {"Doc#Box.Length", "Doc#Sheet.A2"})
+    );
+    EXPECT_TRUE(deps.getCells("Doc#Unknown.Prop").empty());
+    EXPECT_TRUE(deps.getNames(CellAddress(5, 5)).empty());
+}
+
+TEST(CellDependencyMap, eraseKeepsOtherCells)  // NOLINT
+{
+    CellDependencyMap deps;
+    for (int row = 0; row < 10; ++row) {
+        deps.insert(CellAddress(row, 0), "Doc#Params.Width");
+        deps.insert(CellAddress(row, 0), "Doc#Params.Row" + std::to_string(row));
+    }
+
+    EXPECT_TRUE(deps.erase(CellAddress(0, 0)));
+    EXPECT_FALSE(deps.erase(CellAddress(0, 0)));
+    EXPECT_TRUE(deps.erase(CellAddress(4, 0)));
+
+    // the remaining cells were moved around inside the arrays, erase them in turn to check
+    // that they can still be found
+    std::set<CellAddress> expected;
+    for (int row : {1, 2, 3, 5, 6, 7, 8, 9}) {
+        expected.insert(CellAddress(row, 0));
+    }
+    for (int row : {9, 1, 5, 2}) {
+        const auto& cells = deps.getCells("Doc#Params.Width");
+        EXPECT_EQ(std::set<CellAddress>(cells.begin(), cells.end()), expected);
+        EXPECT_TRUE(deps.erase(CellAddress(row, 0)));
+        expected.erase(CellAddress(row, 0));
+    }
+    EXPECT_EQ(deps.getCells("Doc#Params.Width").size(), expected.size());
+    EXPECT_TRUE(deps.getCells("Doc#Params.Row9").empty());
+    EXPECT_EQ(deps.getNames(CellAddress(3, 0)).size(), 2);
+
+    deps.clear();
+    EXPECT_TRUE(deps.getCells("Doc#Params.Width").empty());
+}
@@ -5,6 +5,9 @@
 
 #include <memory>
 
+#include <App/Application.h>
+#include <App/Document.h>
+#include <App/PropertyStandard.h>
 #include <Mod/Spreadsheet/App/Sheet.h>
 #include <Mod/Spreadsheet/App/PropertySheet.h>
 
@@ -86,3 +89,97 @@ TEST_F(PropertySheetTest, invalidAliases)  // NOLINT
             << "\"" << name << "\" was accepted as an alias name, and should not be";
     }
 }
+
+class PropertySheetDocumentTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+    void SetUp() override
+    {
+        _docName = App::GetApplication().getUniqueDocumentName("test");
+        _doc = App::GetApplication().newDocument(_docName.c_str(), "testUser");
+        _sheet = freecad_cast<Spreadsheet::Sheet*>(_doc->addObject("Spreadsheet::Sheet", "Sheet"));
+    }
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(_docName.c_str());
+    }
+
+    long value(const char* address)
+    {
+        auto prop = freecad_cast<App::PropertyInteger*>(_sheet->getPropertyByName(address));
+        return prop ? prop->getValue() : -1;
+    }
+
+    /// The cells to recompute when the cell at \a address changes
+    std::set<App::CellAddress> dependants(const char* address)
+    {
+        return _sheet->getCells()->getDeps(_sheet->getFullName() + "." + address);
+    }
+
+    std::string _docName;
+    App::Document* _doc {};
+    Spreadsheet::Sheet* _sheet {};
+};
+
+TEST_F(PropertySheetDocumentTest, dependenciesFollowMovedCells)  // NOLINT
+{
+    // Arrange
+    _sheet->setCell("A1", "2");
+    _sheet->setCell("B1", "=A1 * 3");
+    _sheet->setCell("B2", "=A1 + B1");
+    _doc->recompute();
+    EXPECT_EQ(value("B2"), 8);
+    EXPECT_EQ(
+        dependants("A1"),
+        (std::set<App::CellAddress> {App::CellAddress("B1"), App::CellAddress("B2")})
+    );
+
+    // Act
+    _sheet->insertRows(0, 2);
+    _sheet->setCell("A3", "5");
+    _doc->recompute();
+
+    // Assert
+    EXPECT_TRUE(dependants("A1").empty());
+    EXPECT_EQ(
+        dependants("A3"),
+        (std::set<App::CellAddress> {App::CellAddress("B3"), App::CellAddress("B4")})
+    );
+    EXPECT_EQ(value("B3"), 15);
+    EXPECT_EQ(value("B4"), 20);
+
+    // Act
+    _sheet->removeRows(0, 2);
+    _sheet->setCell("A1", "1");
+    _doc->recompute();
+
+    // Assert
+    EXPECT_EQ(_sheet->getCell(App::CellAddress("A3")), nullptr);
+    EXPECT_EQ(value("B1"), 3);
+    EXPECT_EQ(value("B2"), 4);
+}
+
+TEST_F(PropertySheetDocumentTest, pasteRestoresCopiedCells)  // NOLINT
+{
+    // Arrange
+    _sheet->setCell("A1", "2");
+    _sheet->setCell("A2", "=A1 * 2");
+    _doc->recompute();
+    std::unique_ptr<App::Property> copy(_sheet->getCells()->Copy());
+
+    // Act
+    _sheet->setCell("A1", "3");
+    _sheet->setCell("C40", "=A2 + 1");
+    _sheet->getCells()->Paste(*copy);
+    _doc->recompute();
+
+    // Assert
+    EXPECT_EQ(_sheet->getCell(App::CellAddress("C40")), nullptr);
+    EXPECT_TRUE(dependants("A2").empty());
+    EXPECT_EQ(value("A2"), 4);
+    EXPECT_EQ(_sheet->getCells()->getUsedCells().size(), 2);
+}
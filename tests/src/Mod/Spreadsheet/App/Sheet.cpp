@@ -0,0 +1,307 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include "src/App/InitApplication.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <App/ExpressionParser.h>
+#include <App/PropertyStandard.h>
+#include <Mod/Spreadsheet/App/Sheet.h>
+
+class SheetTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+    void SetUp() override
+    {
+        _docName = App::GetApplication().getUniqueDocumentName("test");
+        _doc = App::GetApplication().newDocument(_docName.c_str(), "testUser");
+        _sheet = freecad_cast<Spreadsheet::Sheet*>(_doc->addObject("Spreadsheet::Sheet", "Sheet"));
+    }
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(_docName.c_str());
+    }
+
+    /// Whether the cell at \a address has a property, without creating it
+    static bool hasProperty(const Spreadsheet::Sheet* sheet, const char* address)
+    {
+        auto names = sheet->getDynamicPropertyNames();
+        return std::find(names.begin(), names.end(), address) != names.end();
+    }
+
+    static long value(const Spreadsheet::Sheet* sheet, const char* address)
+    {
+        auto prop = freecad_cast<App::PropertyInteger*>(sheet->getPropertyByName(address));
+        return prop ? prop->getValue() : -1;
+    }
+
+    /// The value of the property of the cell at \a address, without updating it
+    static long storedValue(const Spreadsheet::Sheet* sheet, const char* address)
+    {
+        std::vector<std::pair<const char*, App::Property*>> props;
+        sheet->getPropertyNamedList(props);
+        for (const auto& [name, prop] : props) {
+            if (std::string(name) == address) {
+                auto integer = freecad_cast<App::PropertyInteger*>(prop);
+                return integer ? integer->getValue() : -1;
+            }
+        }
+        return -1;
+    }
+
+    std::string _docName;
+    App::Document* _doc {};
+    Spreadsheet::Sheet* _sheet {};
+};
+
+TEST_F(SheetTest, propertiesAreCreatedOnDemand)  // NOLINT
+{
+    // Arrange
+    _sheet->setCell("A1", "2");
+    _sheet->setCell("B1", "=A1 * 3");
+    _sheet->setCell("C1", "text");
+
+    // Act
+    _doc->recompute();
+
+    // Assert
+    EXPECT_TRUE(hasProperty(_sheet, "A1"));  // referenced by B1
+    EXPECT_FALSE(hasProperty(_sheet, "B1"));
+    EXPECT_FALSE(hasProperty(_sheet, "C1"));
+    EXPECT_EQ(value(_sheet, "B1"), 6);
+    EXPECT_TRUE(hasProperty(_sheet, "B1"));
+    auto text = freecad_cast<App::PropertyString*>(_sheet->getPropertyByName("C1"));
+    ASSERT_NE(text, nullptr);
+    EXPECT_STREQ(text->getValue(), "text");
+
+    // Act
+    _sheet->setCell("A1", "3");
+    _doc->recompute();
+
+    // Assert: a created property follows the value of its cell
+    EXPECT_EQ(value(_sheet, "B1"), 9);
+}
+
+TEST_F(SheetTest, computedValuesAreReadWithoutProperties)  // NOLINT
+{
+    // Arrange
+    _sheet->setCell("A1", "=2 * 3");
+
+    // Act
+    _doc->recompute();
+    auto cell = _sheet->getCell(App::CellAddress("A1"));
+
+    // Assert: views read the value from the cell and leave the cell unexposed
+    ASSERT_NE(cell, nullptr);
+    auto number = freecad_cast<const App::NumberExpression*>(cell->getComputedValue());
+    ASSERT_NE(number, nullptr);
+    EXPECT_EQ(number->getValue(), 6.0);
+    EXPECT_FALSE(hasProperty(_sheet, "A1"));
+}
+
+TEST_F(SheetTest, aliasedCellsHaveProperties)  // NOLINT
+{
+    // Arrange
+    _sheet->setCell("A1", "5");
+    _sheet->setAlias(App::CellAddress("A1"), "width");
+    _sheet->setCell("A2", "7");
+
+    // Act
+    _doc->recompute();
+
+    // Assert
+    EXPECT_TRUE(hasProperty(_sheet, "A1"));
+    EXPECT_FALSE(hasProperty(_sheet, "A2"));
+    EXPECT_EQ(value(_sheet, "width"), 5);
+}
+
+TEST_F(SheetTest, unaliasedCellsKeepTheirProperty)  // NOLINT
+{
+    // Arrange
+    _sheet->setCell("A1", "5");
+    _sheet->setAlias(App::CellAddress("A1"), "width");
+    _doc->recompute();
+    EXPECT_EQ(storedValue(_sheet, "A1"), 5);
+
+    // Act
+    _sheet->setAlias(App::CellAddress("A1"), "");
+    _sheet->setCell("A1", "6");
+    _doc->recompute();
+
+    // Assert
+    EXPECT_EQ(storedValue(_sheet, "A1"), 6);
+}
+
+TEST_F(SheetTest, exposedCellsMoveWithRows)  // NOLINT
+{
+    // Arrange
+    auto other = freecad_cast<Spreadsheet::Sheet*>(_doc->addObject("Spreadsheet::Sheet", "Other"));
+    _sheet->setCell("B2", "6");
+    other->setCell("A1", "=Sheet.B2 + 1");
+    _doc->recompute();
+    EXPECT_EQ(value(other, "A1"), 7);
+
+    // Act
+    _sheet->removeRows(0, 1);
+    _doc->recompute();
+    _sheet->setCell("B2", "8");
+    _doc->recompute();
+
+    // Assert: B1 is exposed now, the new B2 nothing refers to is not
+    EXPECT_EQ(value(other, "A1"), 7);
+    EXPECT_TRUE(hasProperty(_sheet, "B1"));
+    EXPECT_FALSE(hasProperty(_sheet, "B2"));
+}
+
+TEST_F(SheetTest, externalReferencesFollowCells)  // NOLINT
+{
+    // Arrange
+    auto other = freecad_cast<Spreadsheet::Sheet*>(_doc->addObject("Spreadsheet::Sheet", "Other"));
+    _sheet->setCell("A1", "2");
+    _sheet->setCell("B1", "=A1 * 3");
+    other->setCell("A1", "=Sheet.B1 + 1");
+    _doc->recompute();
+    EXPECT_EQ(value(other, "A1"), 7);
+
+    // Act
+    _sheet->setCell("A1", "4");
+    _doc->recompute();
+
+    // Assert
+    EXPECT_EQ(value(other, "A1"), 13);
+}
+
+TEST_F(SheetTest, clearedCellsLoseTheirProperty)  // NOLINT
+{
+    // Arrange
+    _sheet->setCell("A1", "2");
+    _doc->recompute();
+    EXPECT_EQ(value(_sheet, "A1"), 2);
+
+    // Act
+    _sheet->clear(App::CellAddress("A1"));
+    _doc->recompute();
+
+    // Assert
+    EXPECT_FALSE(hasProperty(_sheet, "A1"));
+    EXPECT_EQ(_sheet->getPropertyByName("A1"), nullptr);
+}
+
+TEST_F(SheetTest, wideLevelsAreRecomputed)  // NOLINT
+{
+    // Arrange: enough independent cells per level to be evaluated concurrently
+    const int rows = 1000;
+    _sheet->setCell("C1", "3");
+    _sheet->setAlias(App::CellAddress("C1"), "factor");
+    for (int row = 1; row <= rows; ++row) {
+        std::string index = std::to_string(row);
+        _sheet->setCell(("A" + index).c_str(), index.c_str());
+        _sheet->setCell(("B" + index).c_str(), ("=A" + index + " * factor + 1").c_str());
+    }
+
+    // Act
+    _doc->recompute();
+
+    // Assert
+    EXPECT_EQ(value(_sheet, "B1"), 4);
+    EXPECT_EQ(value(_sheet, "B1000"), 3001);
+
+    // Act
+    _sheet->setCell("C1", "5");
+    _doc->recompute();
+
+    // Assert
+    for (int row = 1; row <= rows; ++row) {
+        std::string address = "B" + std::to_string(row);
+        EXPECT_EQ(value(_sheet, address.c_str()), row * 5 + 1) << address;
+    }
+    if (std::thread::hardware_concurrency() > 1) {
+        // The level of the B cells was evaluated concurrently
+        EXPECT_EQ(_sheet->getConcurrentlyEvaluatedCells(), static_cast<std::size_t>(rows));
+    }
+}
+
+TEST_F(SheetTest, cyclicDependenciesAreReported)  // NOLINT
+{
+    // Arrange
+    _sheet->setCell("A1", "=B1 + 1");
+    _sheet->setCell("B1", "=A1 + 1");
+
+    // Act
+    _doc->recompute();
+
+    // Assert
+    EXPECT_TRUE(_sheet->getCell(App::CellAddress("A1"))->hasException());
+    EXPECT_TRUE(_sheet->getCell(App::CellAddress("B1"))->hasException());
+}
+
+TEST_F(SheetTest, importedFilesRoundTrip)  // NOLINT
+{
+    // Arrange
+    const auto input = std::filesystem::temp_directory_path() / "SheetTest_import.csv";
+    const auto output = std::filesystem::temp_directory_path() / "SheetTest_export.csv";
+    {
+        std::ofstream file(input, std::ios::binary);
+        file << "1\t2.5\ttext\n=A1 + 1\t'007\n";
+    }
+
+    // Act
+    bool imported = _sheet->importFromFile(input.string());
+    _doc->recompute();
+    bool exported = _sheet->exportToFile(output.string());
+
+    // Assert
+    EXPECT_TRUE(imported);
+    EXPECT_TRUE(exported);
+    EXPECT_EQ(value(_sheet, "A1"), 1);
+    EXPECT_EQ(value(_sheet, "A2"), 2);
+    auto text = freecad_cast<App::PropertyString*>(_sheet->getPropertyByName("B2"));
+    ASSERT_NE(text, nullptr);
+    EXPECT_STREQ(text->getValue(), "007");
+    std::ifstream file(output, std::ios::binary);
+    std::stringstream content;
+    content << file.rdbuf();
+    EXPECT_EQ(content.str(), "1\t2.5\ttext\n2\t007\n");
+
+    std::filesystem::remove(input);
+    std::filesystem::remove(output);
+}
+
+TEST_F(SheetTest, largeFilesAreImported)  // NOLINT
+{
+    // Arrange: enough lines to be parsed in several chunks
+    const int rows = 3000;
+    const auto input = std::filesystem::temp_directory_path() / "SheetTest_large.csv";
+    {
+        std::ofstream file(input, std::ios::binary);
+        for (int row = 1; row <= rows; ++row) {
+            file << row << "\t=A" << row << " * 2\n";
+        }
+    }
+
+    // Act
+    bool imported = _sheet->importFromFile(input.string());
+    _doc->recompute();
+
+    // Assert
+    EXPECT_TRUE(imported);
+    EXPECT_EQ(value(_sheet, "A1"), 1);
+    EXPECT_EQ(value(_sheet, "B1500"), 3000);
+    EXPECT_EQ(value(_sheet, "B3000"), 6000);
+
+    std::filesystem::remove(input);
+}
@@ -0,0 +1,236 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+// Headless benchmark of large spreadsheets.
+//
+// Fills synthetic sheets, like the ones imported from engineering tables, and times:
+//  - filling the cells with Sheet::setCell,
+//  - the first recompute of the whole sheet,
+//  - an edit of a cell many others depend on, followed by a recompute,
+//  - inserting rows at the top of the sheet, which moves every cell,
+//  - saving the document and loading it back.
+// It also reports the growth of the resident memory while filling the sheet, and the memory
+// used by the cell store and dependency index of the sheet, and the number of cells that have a
+// property.
+//
+// Usage: Spreadsheet_benchmark [--scale N] [--repeat N] [--filter SCENARIO] [--output FILE]
+
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+# include <unistd.h>
+#endif
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <Mod/Spreadsheet/App/Sheet.h>
+#include <Mod/Spreadsheet/App/Utils.h>
+#include <src/App/InitApplication.h>
+#include <src/Benchmark.h>
+
+namespace
+{
+
+using tests::benchmark::Harness;
+using tests::benchmark::Record;
+using tests::benchmark::timeMs;
+
+constexpr int columnCount = 10;
+
+struct Options
+{
+    int scale {1};
+};
+
+struct Scenario
+{
+    std::string name;
+    // Returns the content of the cell at (row, column). The first cell A1 is not asked for, it
+    // is the parameter aliased as "factor", which the edit phase changes.
+    std::function<std::string(int, int)> content;
+};
+
+std::string cellName(int row, int column)
+{
+    return Spreadsheet::columnName(column) + Spreadsheet::rowName(row);
+}
+
+// Plain numbers only, like an imported table
+std::string valuesContent(int row, int column)
+{
+    return std::to_string(row * columnCount + column) + ".5";
+}
+
+// A column of inputs, every other column derived from its left neighbour and the parameter
+std::string formulasContent(int row, int column)
+{
+    if (column == 0) {
+        return std::to_string(row) + ".25";
+    }
+    return "=" + cellName(row, column - 1) + " * factor + 1";
+}
+
+// A long dependency chain down the first column, the other columns derived from it
+std::string chainsContent(int row, int column)
+{
+    if (column == 0) {
+        return "=" + cellName(row - 1, 0) + " + factor";
+    }
+    return "=" + cellName(row, 0) + " * " + std::to_string(column);
+}
+
+// Resident memory of the process in KiB, or 0 where it is not known
+long residentKb()
+{
+#ifdef __linux__
+    std::ifstream statm("/proc/self/statm");
+    long size = 0;
+    long resident = 0;
+    if (statm >> size >> resident) {
+        return resident * (sysconf(_SC_PAGESIZE) / 1024);
+    }
+#endif
+    return 0;
+}
+
+class Benchmark
+{
+public:
+    Benchmark(const Options& options, Harness& harness)
+        : options(options)
+        , harness(harness)
+    {}
+
+    bool run(const Scenario& scenario)
+    {
+        const int rows = 1000 * options.scale;
+        cells = rows * columnCount;
+        const auto file = std::filesystem::temp_directory_path()
+            / ("Spreadsheet_benchmark_" + scenario.name + ".FCStd");
+
+        std::vector<double> fill;
+        std::vector<double> recompute;
+        std::vector<double> edit;
+        std::vector<double> insertRows;
+        std::vector<double> save;
+        std::vector<double> load;
+        long rssKb = 0;
+        unsigned int indexBytes = 0;
+        std::size_t properties = 0;
+
+        for (int i = 0; i < harness.repeat(); ++i) {
+            std::string docName = App::GetApplication().getUniqueDocumentName("benchmark");
+            auto doc = App::GetApplication().newDocument(docName.c_str(), "benchmark");
+            auto sheet = freecad_cast<Spreadsheet::Sheet*>(
+                doc->addObject("Spreadsheet::Sheet", "Sheet")
+            );
+            if (!sheet) {
+                std::cerr << "Cannot create a sheet, is the Spreadsheet module available?\n";
+                return false;
+            }
+
+            long rssBefore = residentKb();
+            fill.push_back(timeMs([&]() {
+                sheet->setAlias(App::CellAddress(0, 0), "factor");
+                for (int row = 0; row < rows; ++row) {
+                    for (int column = 0; column < columnCount; ++column) {
+                        std::string content = row == 0 && column == 0
+                            ? "1.5"
+                            : scenario.content(row, column);
+                        sheet->setCell(App::CellAddress(row, column), content.c_str());
+                    }
+                }
+            }));
+            recompute.push_back(timeMs([&]() { doc->recompute(); }));
+            rssKb = residentKb() - rssBefore;
+            indexBytes = sheet->getCells()->getMemSize();
+            properties = sheet->getDynamicPropertyNames().size();
+
+            edit.push_back(timeMs([&]() {
+                sheet->setCell(App::CellAddress(0, 0), "2.5");
+                doc->recompute();
+            }));
+            insertRows.push_back(timeMs([&]() { sheet->insertRows(1, 10); }));
+            doc->recompute();
+
+            save.push_back(timeMs([&]() { doc->saveAs(file.string().c_str()); }));
+            App::GetApplication().closeDocument(docName.c_str());
+
+            App::Document* loaded = nullptr;
+            load.push_back(timeMs([&]() {
+                loaded = App::GetApplication().openDocument(file.string().c_str());
+            }));
+            if (loaded) {
+                App::GetApplication().closeDocument(loaded->getName());
+            }
+        }
+        std::filesystem::remove(file);
+
+        report(scenario, "fill", fill);
+        report(scenario, "recompute", recompute);
+        report(scenario, "edit", edit);
+        report(scenario, "insertRows", insertRows);
+        report(scenario, "save", save);
+        report(scenario, "load", load);
+        header(scenario)
+            .add("phase", "memory")
+            .add("rss_kb", rssKb)
+            .add("index_kb", indexBytes / 1024)
+            .add("properties", properties)
+            .write(harness.out());
+        return true;
+    }
+
+private:
+    Record header(const Scenario& scenario) const
+    {
+        Record record;
+        record.add("scenario", scenario.name).add("scale", options.scale).add("cells", cells);
+        return record;
+    }
+
+    void report(const Scenario& scenario, const char* phase, const std::vector<double>& samples)
+    {
+        header(scenario).add("phase", phase).addSamples(samples).write(harness.out());
+    }
+
+    const Options& options;
+    Harness& harness;
+    int cells {0};
+};
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    Options options;
+    Harness harness(3);
+    harness.addOption("--scale", options.scale);
+    if (!harness.init(argc, argv)) {
+        return 1;
+    }
+
+    tests::initApplication();
+
+    const std::vector<Scenario> scenarios {
+        {"values", valuesContent},
+        {"formulas", formulasContent},
+        {"chains", chainsContent},
+    };
+
+    Benchmark benchmark(options, harness);
+    for (const auto& scenario : scenarios) {
+        if (!harness.selected(scenario.name)) {
+            continue;
+        }
+        if (!benchmark.run(scenario)) {
+            return 1;
+        }
+    }
+
+    return 0;
+}